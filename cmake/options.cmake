@@ -125,8 +125,8 @@ set(DNNL_ENABLE_PRIMITIVE "ALL" CACHE STRING
     - <PRIMITIVE_NAME>. Includes only the selected primitive to be enabled.
       Possible values are: BATCH_NORMALIZATION, BINARY, CONCAT, CONVOLUTION,
       DECONVOLUTION, ELTWISE, INNER_PRODUCT, LAYER_NORMALIZATION, LRN, MATMUL,
-      POOLING, PRELU, REDUCTION, REORDER, RESAMPLING, RNN, SHUFFLE, SOFTMAX,
-      SUM.
+      OPTIMIZER, POOLING, PRELU, REDUCTION, REORDER, RESAMPLING, RNN, SHUFFLE,
+      SOFTMAX, SOFTMAX_CROSS_ENTROPY, SUM.
     - <PRIMITIVE_NAME>;<PRIMITIVE_NAME>;... Includes only selected primitives to
       be enabled at build time. This is treated as CMake string, thus, semicolon
       is a mandatory delimiter between names. This is the way to specify several
@@ -0,0 +1,200 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+/// @example prepacked_weights.cpp
+/// > Annotated version: @ref prepacked_weights_cpp
+///
+/// @page prepacked_weights_cpp_short
+///
+/// This C++ API example demonstrates how to store weights reordered to the
+/// format a primitive expects together with their memory descriptor, and
+/// how to reuse them later without a reorder.
+///
+/// Key concepts:
+/// - Memory descriptor blobs (@ref dnnl::memory::desc::get_blob).
+/// - Checking stored weights against the format a primitive expects.
+///
+/// @page prepacked_weights_cpp Prepacked Weights Example
+/// @copydetails prepacked_weights_cpp_short
+///
+/// The example is run as `prepacked_weights [cpu|gpu] [file]`. If the file
+/// does not exist, the weights are reordered and saved to it first. When no
+/// file is given, a temporary one is saved, loaded, and removed.
+///
+/// @include prepacked_weights.cpp
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "example_utils.hpp"
+#include "oneapi/dnnl/dnnl.hpp"
+
+using namespace dnnl;
+
+using tag = memory::format_tag;
+using dt = memory::data_type;
+
+namespace {
+
+// Convolution with the weights format left for the implementation to choose.
+convolution_forward::primitive_desc make_conv_pd(const engine &eng) {
+    const memory::dims src_dims = {1, 64, 28, 28};
+    const memory::dims weights_dims = {128, 64, 3, 3};
+    const memory::dims dst_dims = {1, 128, 28, 28};
+    const memory::dims strides = {1, 1}, padding = {1, 1};
+
+    auto src_md = memory::desc(src_dims, dt::f32, tag::any);
+    auto weights_md = memory::desc(weights_dims, dt::f32, tag::any);
+    auto dst_md = memory::desc(dst_dims, dt::f32, tag::any);
+
+    return convolution_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::convolution_direct,
+            src_md, weights_md, dst_md, strides, padding, padding);
+}
+
+// Weights as they come from a framework: in a plain format.
+memory make_user_weights(const engine &eng) {
+    auto md = memory::desc({128, 64, 3, 3}, dt::f32, tag::oihw);
+    std::vector<float> data(product(md.get_dims()));
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = (float)((i * 37) % 101) / 101.f - 0.5f;
+
+    memory mem(md, eng);
+    write_to_dnnl_memory(data.data(), mem);
+    return mem;
+}
+
+memory reorder_weights(const engine &eng, stream &strm,
+        const memory::desc &weights_md, memory &user_weights) {
+    memory weights(weights_md, eng);
+    reorder(user_weights, weights).execute(strm, user_weights, weights);
+    strm.wait();
+    return weights;
+}
+
+void write_chunk(std::ofstream &out, const std::vector<uint8_t> &chunk) {
+    const uint64_t size = chunk.size();
+    out.write(reinterpret_cast<const char *>(&size), sizeof(size));
+    out.write(reinterpret_cast<const char *>(chunk.data()), chunk.size());
+}
+
+std::vector<uint8_t> read_chunk(std::ifstream &in) {
+    uint64_t size = 0;
+    in.read(reinterpret_cast<char *>(&size), sizeof(size));
+    std::vector<uint8_t> chunk(in ? size : 0);
+    in.read(reinterpret_cast<char *>(chunk.data()), chunk.size());
+    if (!in) throw std::runtime_error("could not read the weights file");
+    return chunk;
+}
+
+// Offline stage: reorder the weights once and store them together with the
+// memory descriptor of the format they are in.
+void save_weights(engine &eng, stream &strm, const std::string &path) {
+    auto conv_pd = make_conv_pd(eng);
+    auto user_weights = make_user_weights(eng);
+    auto weights = reorder_weights(
+            eng, strm, conv_pd.weights_desc(), user_weights);
+
+    std::vector<uint8_t> data(weights.get_desc().get_size());
+    read_from_dnnl_memory(data.data(), weights);
+
+    std::ofstream out(path, std::ios::binary);
+    write_chunk(out, weights.get_desc().get_blob());
+    write_chunk(out, data);
+    if (!out) throw std::runtime_error("could not write the weights file");
+    std::cout << "Saved weights to " << path << "." << std::endl;
+}
+
+// Online stage: use the stored weights as is if they are in the format the
+// primitive expects, and fall back to a reorder otherwise, for example when
+// the file was produced on a machine with a different instruction set.
+memory load_weights(engine &eng, stream &strm,
+        const convolution_forward::primitive_desc &conv_pd,
+        const std::string &path) {
+    std::ifstream in(path, std::ios::binary);
+    auto blob = read_chunk(in);
+    auto data = read_chunk(in);
+
+    memory::desc stored_md;
+    try {
+        stored_md = memory::desc(blob);
+    } catch (error &) {
+        // The file was produced by a different version of the library.
+    }
+
+    if (!stored_md.is_zero() && stored_md == conv_pd.weights_desc()
+            && data.size() == stored_md.get_size()) {
+        std::cout << "Stored weights match the expected format, "
+                  << "the reorder is skipped." << std::endl;
+        memory weights(stored_md, eng);
+        write_to_dnnl_memory(data.data(), weights);
+        return weights;
+    }
+
+    std::cout << "Stored weights do not match the expected format, "
+              << "reordering." << std::endl;
+    auto user_weights = make_user_weights(eng);
+    return reorder_weights(eng, strm, conv_pd.weights_desc(), user_weights);
+}
+
+} // namespace
+
+void prepacked_weights_example(
+        engine::kind engine_kind, int argc, char **argv) {
+    engine eng(engine_kind, 0);
+    stream strm(eng);
+
+    const bool use_temporary_file = argc < 3;
+    const std::string path
+            = use_temporary_file ? "prepacked_weights.bin" : argv[2];
+
+    if (!std::ifstream(path).good()) save_weights(eng, strm, path);
+
+    auto conv_pd = make_conv_pd(eng);
+    auto weights = load_weights(eng, strm, conv_pd, path);
+    if (use_temporary_file) std::remove(path.c_str());
+
+    // Check the loaded weights against the freshly reordered ones.
+    auto user_weights = make_user_weights(eng);
+    auto expected = reorder_weights(
+            eng, strm, conv_pd.weights_desc(), user_weights);
+
+    const size_t size = conv_pd.weights_desc().get_size();
+    std::vector<uint8_t> got(size), exp(size);
+    read_from_dnnl_memory(got.data(), weights);
+    read_from_dnnl_memory(exp.data(), expected);
+    if (got != exp) throw std::logic_error("Loaded weights mismatch");
+
+    memory src(conv_pd.src_desc(), eng), dst(conv_pd.dst_desc(), eng);
+    std::vector<float> src_data(conv_pd.src_desc().get_size() / sizeof(float));
+    for (size_t i = 0; i < src_data.size(); ++i)
+        src_data[i] = (float)(i % 7) - 3.f;
+    write_to_dnnl_memory(src_data.data(), src);
+    convolution_forward(conv_pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, weights},
+                    {DNNL_ARG_DST, dst}});
+    strm.wait();
+}
+
+int main(int argc, char **argv) {
+    return handle_example_errors(prepacked_weights_example,
+            parse_engine_kind(argc, argv, 1), argc, argv);
+}
@@ -202,6 +202,53 @@ dnnl_status_t DNNL_API dnnl_primitive_create_from_cache_blob(
 dnnl_status_t DNNL_API dnnl_primitive_execute(const_dnnl_primitive_t primitive,
         dnnl_stream_t stream, int nargs, const dnnl_exec_arg_t *args);
 
+/// Creates a set of execution arguments bound to a primitive.
+///
+/// The arguments are validated against the primitive once, at creation time,
+/// so that executing the primitive with the bound set via
+/// #dnnl_primitive_execute_bound() skips the per-call argument conversion
+/// done by #dnnl_primitive_execute().
+///
+/// The bound set keeps references to the memory objects, not to their data.
+/// To execute the primitive on other buffers of the same shape, change the
+/// data handles of the bound memory objects with
+/// #dnnl_memory_set_data_handle().
+///
+/// @param primitive_args Output primitive arguments.
+/// @param primitive Primitive the arguments are bound to.
+/// @param nargs Number of arguments.
+/// @param args Array of arguments with the same semantics as the @p args
+///     parameter of #dnnl_primitive_execute().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+///
+/// @note The primitive and the memory objects must outlive the primitive
+///     arguments object.
+dnnl_status_t DNNL_API dnnl_primitive_args_create(
+        dnnl_primitive_args_t *primitive_args, const_dnnl_primitive_t primitive,
+        int nargs, const dnnl_exec_arg_t *args);
+
+/// Destroys a set of primitive execution arguments.
+///
+/// @param primitive_args Primitive arguments to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_args_destroy(
+        dnnl_primitive_args_t primitive_args);
+
+/// Executes a primitive with a set of pre-bound arguments.
+///
+/// @param primitive Primitive to execute. Must be the primitive
+///     @p primitive_args were created for.
+/// @param stream Stream to use.
+/// @param primitive_args Arguments created with
+///     #dnnl_primitive_args_create().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_execute_bound(
+        const_dnnl_primitive_t primitive, dnnl_stream_t stream,
+        const_dnnl_primitive_args_t primitive_args);
+
 /// Retrieves a constant reference to the primitive descriptor of a given
 /// primitive.
 ///
@@ -240,6 +287,52 @@ dnnl_status_t DNNL_API dnnl_primitive_get_cache_blob(
 ///     otherwise.
 dnnl_status_t DNNL_API dnnl_primitive_destroy(dnnl_primitive_t primitive);
 
+/// Starts capturing primitive executions submitted to a stream.
+///
+/// While a stream is capturing, primitives executed on it with
+/// #dnnl_primitive_execute() or #dnnl_primitive_execute_bound() are not run.
+/// Their arguments are validated and recorded instead, in submission order,
+/// until #dnnl_stream_end_capture() is called.
+///
+/// @param stream Stream to capture. Only CPU streams are supported.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_begin_capture(dnnl_stream_t stream);
+
+/// Stops capturing primitive executions and returns them as an execution
+/// plan.
+///
+/// @param stream Stream that is capturing.
+/// @param exec_plan Output execution plan.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_stream_end_capture(
+        dnnl_stream_t stream, dnnl_exec_plan_t *exec_plan);
+
+/// Executes all primitives recorded in an execution plan, in the order they
+/// were captured.
+///
+/// The plan refers to the memory objects passed at capture time rather than
+/// to their data, so the data handles of those memory objects may be changed
+/// between executions with #dnnl_memory_set_data_handle().
+///
+/// @param exec_plan Execution plan to execute.
+/// @param stream Stream to use. The stream must belong to the same engine as
+///     the stream the plan was captured on.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+///
+/// @note The memory objects passed at capture time must outlive the plan.
+dnnl_status_t DNNL_API dnnl_exec_plan_execute(
+        const_dnnl_exec_plan_t exec_plan, dnnl_stream_t stream);
+
+/// Destroys an execution plan.
+///
+/// @param exec_plan Execution plan to destroy.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_exec_plan_destroy(dnnl_exec_plan_t exec_plan);
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_attributes
@@ -294,6 +387,39 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_fpmath_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_fpmath_mode(
         dnnl_primitive_attr_t attr, dnnl_fpmath_mode_t mode);
 
+/// Returns the floating-point math mode primitive attribute together with
+/// the flag that controls whether it applies to integer weights.
+///
+/// @param attr Primitive attributes.
+/// @param mode Output FP math mode.
+/// @param apply_to_int Output flag. Can be NULL.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_fpmath_mode_v2(
+        const_dnnl_primitive_attr_t attr, dnnl_fpmath_mode_t *mode,
+        int *apply_to_int);
+
+/// Sets the floating-point math mode primitive attributes.
+///
+/// When @p apply_to_int is set to 1, integer weights of a primitive with
+/// floating-point activations are up-converted (decompressed) to the
+/// floating-point compute type, using the weights scales and zero points,
+/// and @p mode defines the type used for the computation.
+///
+/// @param attr Primitive attributes.
+/// @param mode FP math mode. The possible values are:
+///     #dnnl_fpmath_mode_strict (default),
+///     #dnnl_fpmath_mode_bf16,
+///     #dnnl_fpmath_mode_f16,
+///     #dnnl_fpmath_mode_tf32,
+///     #dnnl_fpmath_mode_any.
+/// @param apply_to_int Whether the FP math mode applies to integer weights.
+///     The possible values are 0 (default) and 1.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_fpmath_mode_v2(
+        dnnl_primitive_attr_t attr, dnnl_fpmath_mode_t mode, int apply_to_int);
+
 /// Returns the primitive attributes scratchpad mode.
 ///
 /// @param attr Primitive attributes.
@@ -314,6 +440,30 @@ dnnl_status_t DNNL_API dnnl_primitive_attr_get_scratchpad_mode(
 dnnl_status_t DNNL_API dnnl_primitive_attr_set_scratchpad_mode(
         dnnl_primitive_attr_t attr, dnnl_scratchpad_mode_t mode);
 
+/// Returns the primitive attributes output selection flag.
+///
+/// @param attr Primitive attributes.
+/// @param value Output selection flag value.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_get_output_select(
+        const_dnnl_primitive_attr_t attr, int *value);
+
+/// Sets the primitive attributes output selection flag. When set, a matmul
+/// primitive computes only the destination columns listed in an s32 index
+/// array passed at execution time as an argument with index
+/// #DNNL_ARG_ATTR_OUTPUT_SELECT. The destination column `n` is computed using
+/// the weights column with index `idx[n]`, so the weights last dimension may
+/// be larger than the destination one.
+///
+/// @param attr Primitive attributes.
+/// @param value Output selection flag value. The possible values are: 0
+///     (default) and 1.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_primitive_attr_set_output_select(
+        dnnl_primitive_attr_t attr, int value);
+
 /// Sets primitive attributes scaling factors for primitive operations for a
 /// given memory argument. The scaling factors must be passed at execution time
 /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -634,6 +784,46 @@ dnnl_status_t DNNL_API dnnl_post_ops_append_prelu(
 dnnl_status_t DNNL_API dnnl_post_ops_get_params_prelu(
         const_dnnl_post_ops_t post_ops, int index, int *mask);
 
+/// Appends a gated linear unit (GLU) post-op.
+///
+/// The post-op splits the result of the operation along the last dimension
+/// into a gate half and an up half of equal sizes and computes:
+///
+///     dst[..., n] <- eltwise_op(res[..., n]) * res[..., n + N]
+///
+/// where N is the size of the last dimension of the destination, so the
+/// operation result has 2 * N elements along it. For example, SwiGLU uses
+/// #dnnl_eltwise_swish with alpha equal to 1 and GeGLU uses
+/// #dnnl_eltwise_gelu_tanh or #dnnl_eltwise_gelu_erf.
+///
+/// The post-op is supported by the matmul primitive only and must be the
+/// first post-op in the chain. Its kind is internal to the library, so use
+/// dnnl_post_ops_get_params_glu() to check whether a post-op is a GLU one.
+///
+/// @param post_ops Post-ops.
+/// @param alg_kind Elementwise algorithm applied to the gate half.
+/// @param alpha Alpha parameter for the elementwise algorithm.
+/// @param beta Beta parameter for the elementwise algorithm.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_post_ops_append_glu(dnnl_post_ops_t post_ops,
+        dnnl_alg_kind_t alg_kind, float alpha, float beta);
+
+/// Returns the parameters of a GLU post-op.
+///
+/// @param post_ops Post-ops.
+/// @param index Index of the GLU post-op.
+/// @param alg_kind Output elementwise algorithm kind.
+/// @param alpha Output alpha parameter for the elementwise algorithm.
+/// @param beta Output beta parameter for the elementwise algorithm.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+/// @returns #dnnl_invalid_arguments if @p index does not refer to a GLU
+///     post-op.
+dnnl_status_t DNNL_API dnnl_post_ops_get_params_glu(
+        const_dnnl_post_ops_t post_ops, int index, dnnl_alg_kind_t *alg_kind,
+        float *alpha, float *beta);
+
 /// @} dnnl_api_attributes
 
 /// @} dnnl_api_primitives
@@ -658,6 +848,37 @@ dnnl_status_t DNNL_API dnnl_memory_desc_destroy(dnnl_memory_desc_t memory_desc);
 dnnl_status_t DNNL_API dnnl_memory_desc_clone(dnnl_memory_desc_t *memory_desc,
         const_dnnl_memory_desc_t existing_memory_desc);
 
+/// Retrieves a binary blob associated with the given memory descriptor.
+///
+/// The blob can be stored together with the data the memory descriptor
+/// describes, for example weights reordered to the format a primitive
+/// expects, and turned back into a memory descriptor with
+/// dnnl_memory_desc_create_with_blob().
+///
+/// @param memory_desc Memory descriptor to serialize.
+/// @param size Size of the blob in bytes.
+/// @param blob Blob of size @p size. If the @p blob is nullptr then the size
+///     of the blob is returned in @p size.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_get_blob(
+        const_dnnl_memory_desc_t memory_desc, size_t *size, uint8_t *blob);
+
+/// Creates a memory descriptor from a binary blob.
+///
+/// @note
+///     The blob identifies the version of the library that created it and
+///     is accepted only by the same version of the library.
+///
+/// @param memory_desc Output memory descriptor.
+/// @param size Size of the blob in bytes.
+/// @param blob Blob of size @p size obtained with
+///     dnnl_memory_desc_get_blob().
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_desc_create_with_blob(
+        dnnl_memory_desc_t *memory_desc, size_t size, const uint8_t *blob);
+
 /// Creates a memory descriptor using dimensions and strides.
 ///
 /// @note
@@ -1024,6 +1245,31 @@ dnnl_status_t DNNL_API dnnl_memory_create_v2(dnnl_memory_t *memory,
         int nhandles, void **handles);
 #endif
 
+/// Creates a read-only memory object backed by a mapping of a file.
+///
+/// The contents of the file starting at @p offset are used as the memory
+/// buffer without being copied: pages are read in from the file when they
+/// are accessed for the first time. The file must hold the data in the
+/// layout described by @p memory_desc, including the padded area if any.
+/// A memory object created this way may be passed to primitives as an input
+/// only. The file descriptor may be closed after the call.
+///
+/// @note
+///     Only CPU engines with a native (non-SYCL) runtime on POSIX systems
+///     are supported. For the best performance @p offset should be a
+///     multiple of 64.
+///
+/// @param memory Output memory object.
+/// @param memory_desc Memory descriptor.
+/// @param engine Engine to use.
+/// @param fd File descriptor of a file opened for reading.
+/// @param offset Offset of the data in the file in bytes.
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_memory_create_from_file(dnnl_memory_t *memory,
+        const_dnnl_memory_desc_t memory_desc, dnnl_engine_t engine, int fd,
+        size_t offset);
+
 /// Returns the memory descriptor for a memory object.
 ///
 /// @param memory Memory object.
@@ -3243,6 +3489,77 @@ dnnl_status_t DNNL_API dnnl_reduction_primitive_desc_create(
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_optimizer Optimizer
+/// @{
+
+/// Creates a primitive descriptor for an optimizer primitive.
+///
+/// @note
+///     The weights and the optimizer states are updated in place.
+///
+/// @note
+///     Diff weights memory descriptor is allowed to be initialized with
+///     #dnnl_format_tag_any or with format_kind set to #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param alg_kind Optimizer algorithm kind. Possible values:
+///     #dnnl_optimizer_sgd, #dnnl_optimizer_adam, #dnnl_optimizer_adamw,
+///     #dnnl_optimizer_lamb.
+/// @param weights_desc Weights memory descriptor.
+/// @param diff_weights_desc Diff weights memory descriptor.
+/// @param beta_1 Decay rate of the first moment. For #dnnl_optimizer_sgd
+///     this is the momentum.
+/// @param beta_2 Decay rate of the second moment. Not used by
+///     #dnnl_optimizer_sgd.
+/// @param epsilon Term added to the denominator for numerical stability. Not
+///     used by #dnnl_optimizer_sgd.
+/// @param weight_decay Weight decay factor.
+/// @param flags Optimizer flags (@ref dnnl_optimizer_flags_t).
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_optimizer_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        dnnl_alg_kind_t alg_kind, const_dnnl_memory_desc_t weights_desc,
+        const_dnnl_memory_desc_t diff_weights_desc, float beta_1, float beta_2,
+        float epsilon, float weight_decay, unsigned flags,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_optimizer
+
+/// @addtogroup dnnl_api_softmax_cross_entropy Softmax Cross-Entropy
+/// @{
+
+/// Creates a primitive descriptor for a softmax cross-entropy primitive.
+///
+/// @note
+///     Source and diff source memory descriptors are allowed to be
+///     initialized with #dnnl_format_tag_any or with format_kind set to
+///     #dnnl_format_kind_any.
+///
+/// @param primitive_desc Output primitive descriptor.
+/// @param engine Engine to use.
+/// @param src_desc Source (logits) memory descriptor of shape N x C.
+/// @param labels_desc Labels memory descriptor of shape N.
+/// @param dst_desc Destination (per-sample loss) memory descriptor of
+///     shape N.
+/// @param diff_src_desc Diff source (gradient of the loss with respect to
+///     the logits) memory descriptor. May be NULL or a zero memory
+///     descriptor if the gradient is not needed.
+/// @param label_smoothing Label smoothing factor in the [0, 1) range.
+/// @param attr Primitive attributes (can be NULL).
+/// @returns #dnnl_success on success and a status describing the error
+///     otherwise.
+dnnl_status_t DNNL_API dnnl_softmax_cross_entropy_primitive_desc_create(
+        dnnl_primitive_desc_t *primitive_desc, dnnl_engine_t engine,
+        const_dnnl_memory_desc_t src_desc, const_dnnl_memory_desc_t labels_desc,
+        const_dnnl_memory_desc_t dst_desc,
+        const_dnnl_memory_desc_t diff_src_desc, float label_smoothing,
+        const_dnnl_primitive_attr_t attr);
+
+/// @} dnnl_api_softmax_cross_entropy
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_primitive_cache
@@ -85,6 +85,20 @@ struct handle_traits<dnnl_primitive_t> {
     }
 };
 
+template <>
+struct handle_traits<dnnl_primitive_args_t> {
+    static dnnl_status_t destructor(dnnl_primitive_args_t p) {
+        return dnnl_primitive_args_destroy(p);
+    }
+};
+
+template <>
+struct handle_traits<dnnl_exec_plan_t> {
+    static dnnl_status_t destructor(dnnl_exec_plan_t p) {
+        return dnnl_exec_plan_destroy(p);
+    }
+};
+
 /// @endcond
 
 /// @} dnnl_api_utils
@@ -92,6 +106,7 @@ struct handle_traits<dnnl_primitive_t> {
 struct stream;
 struct memory;
 struct primitive_desc;
+struct primitive_args;
 
 /// @addtogroup dnnl_api_primitives Primitives
 /// Compute primitives
@@ -148,6 +163,10 @@ struct primitive : public handle<dnnl_primitive_t> {
         layer_normalization = dnnl_layer_normalization,
         /// A group normalization primitive
         group_normalization = dnnl_group_normalization,
+        /// An optimizer primitive.
+        optimizer = dnnl_optimizer,
+        /// A softmax cross-entropy primitive.
+        softmax_cross_entropy = dnnl_softmax_cross_entropy,
     };
 
     using handle::handle;
@@ -212,6 +231,73 @@ struct primitive : public handle<dnnl_primitive_t> {
     /// @param args Arguments map.
     void execute(const stream &astream,
             const std::unordered_map<int, memory> &args) const;
+
+    /// Executes computations specified by the primitive in a specified stream
+    /// using a set of arguments bound to the primitive ahead of time.
+    ///
+    /// @param astream Stream object. The stream must belong to the same engine
+    ///     as the primitive.
+    /// @param args Arguments bound to this primitive.
+    void execute(const stream &astream, const primitive_args &args) const;
+};
+
+/// A set of execution arguments validated and bound to a primitive once.
+///
+/// Executing a primitive with a bound set skips converting and validating
+/// the arguments map on every call. The set refers to the memory objects
+/// rather than to their data, so the primitive can be executed on other
+/// buffers of the same shape by changing the data handles of the bound
+/// memory objects with memory::set_data_handle().
+///
+/// @note The primitive and the memory objects must outlive the set.
+struct primitive_args : public handle<dnnl_primitive_args_t> {
+    using handle::handle;
+
+    /// Default constructor. Constructs an empty object.
+    primitive_args() = default;
+
+    /// Constructs a set of arguments bound to a primitive.
+    ///
+    /// @param aprimitive Primitive to bind the arguments to.
+    /// @param args Arguments map with the same semantics as the one passed
+    ///     to primitive::execute().
+    primitive_args(const primitive &aprimitive,
+            const std::unordered_map<int, memory> &args);
+};
+
+/// An immutable sequence of primitive executions recorded on a stream.
+///
+/// Primitives executed on a stream between exec_plan::begin_capture() and
+/// exec_plan::end_capture() are not run. Their arguments are validated and
+/// recorded instead, and the whole sequence can later be replayed with a
+/// single exec_plan::execute() call. Only CPU streams support capturing.
+///
+/// The plan refers to the memory objects passed at capture time rather than
+/// to their data, so their data handles may be changed between executions.
+///
+/// @note The memory objects passed at capture time must outlive the plan.
+struct exec_plan : public handle<dnnl_exec_plan_t> {
+    using handle::handle;
+
+    /// Default constructor. Constructs an empty object.
+    exec_plan() = default;
+
+    /// Starts capturing primitive executions submitted to a stream.
+    ///
+    /// @param astream Stream to capture.
+    static void begin_capture(const stream &astream);
+
+    /// Stops capturing primitive executions submitted to a stream.
+    ///
+    /// @param astream Stream that is capturing.
+    /// @returns Execution plan with the captured primitive executions.
+    static exec_plan end_capture(const stream &astream);
+
+    /// Executes all the captured primitives in the order they were captured.
+    ///
+    /// @param astream Stream object. The stream must belong to the same
+    ///     engine as the stream the plan was captured on.
+    void execute(const stream &astream) const;
 };
 
 /// Converts primitive kind enum value from C++ API to C API type.
@@ -479,6 +565,14 @@ enum class algorithm {
     softmax_accurate = dnnl_softmax_accurate,
     /// LogSoftmax, numerically stable
     softmax_log = dnnl_softmax_log,
+    /// Stochastic gradient descent, with an optional momentum
+    optimizer_sgd = dnnl_optimizer_sgd,
+    /// Adam
+    optimizer_adam = dnnl_optimizer_adam,
+    /// Adam with decoupled weight decay (AdamW)
+    optimizer_adamw = dnnl_optimizer_adamw,
+    /// Layer-wise adaptive moments (LAMB)
+    optimizer_lamb = dnnl_optimizer_lamb,
 };
 
 /// Converts algorithm kind enum value from C++ API to C API type.
@@ -539,6 +633,28 @@ inline dnnl_normalization_flags_t convert_to_c(normalization_flags flags) {
     return static_cast<dnnl_normalization_flags_t>(flags);
 }
 
+/// Flags for optimizer primitives.
+enum class optimizer_flags : unsigned {
+    /// Use no optimizer flags.
+    none = dnnl_optimizer_flags_none,
+
+    /// Use master weights. If specified, the user is expected to pass an f32
+    /// copy of the weights that the update is applied to. The result is
+    /// written to the weights in their data type.
+    use_master_weights = dnnl_optimizer_use_master_weights,
+
+    /// Compute the squared norm of the gradient. If specified, the library
+    /// outputs the sum of squares of the scaled gradient.
+    compute_diff_weights_norm = dnnl_optimizer_compute_diff_weights_norm,
+};
+
+/// Converts optimizer flags enum value from C++ API to C API type.
+/// @param flags C++ API optimizer flags enum value.
+/// @returns Corresponding C API optimizer flags enum value.
+inline dnnl_optimizer_flags_t convert_to_c(optimizer_flags flags) {
+    return static_cast<dnnl_optimizer_flags_t>(flags);
+}
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_rnn
@@ -560,6 +676,7 @@ inline dnnl_rnn_flags_t convert_to_c(rnn_flags flags) {
 }
 
 DNNL_DEFINE_BITMASK_OPS(normalization_flags)
+DNNL_DEFINE_BITMASK_OPS(optimizer_flags)
 DNNL_DEFINE_BITMASK_OPS(rnn_flags)
 
 /// A direction of RNN primitive execution
@@ -2675,6 +2792,22 @@ struct memory : public handle<dnnl_memory_t> {
         /// @param md The C API memory descriptor.
         desc(dnnl_memory_desc_t md) : handle<dnnl_memory_desc_t>(md) {}
 
+        /// Constructs a memory descriptor from a binary blob obtained with
+        /// #dnnl::memory::desc::get_blob().
+        ///
+        /// @note
+        ///     The blob is accepted only by the same version of the library
+        ///     that created it.
+        ///
+        /// @param blob Binary blob.
+        desc(const std::vector<uint8_t> &blob) {
+            dnnl_memory_desc_t md = nullptr;
+            error::wrap_c_api(dnnl_memory_desc_create_with_blob(
+                                      &md, blob.size(), blob.data()),
+                    "could not create a memory descriptor from a blob");
+            reset(md);
+        }
+
         /// Constructs a memory descriptor for a region inside an area
         /// described by this memory descriptor.
         //
@@ -2982,6 +3115,21 @@ struct memory : public handle<dnnl_memory_t> {
         ///     different memory.
         bool operator!=(const desc &other) const { return !operator==(other); }
 
+        /// Returns a binary blob associated with the memory descriptor. It
+        /// can be stored along with the data the memory descriptor describes
+        /// and used to recreate the descriptor later.
+        /// @returns The binary blob.
+        std::vector<uint8_t> get_blob() const {
+            size_t size = 0;
+            error::wrap_c_api(dnnl_memory_desc_get_blob(get(), &size, nullptr),
+                    "could not get the size of a memory descriptor blob");
+            std::vector<uint8_t> blob(size);
+            error::wrap_c_api(
+                    dnnl_memory_desc_get_blob(get(), &size, blob.data()),
+                    "could not get a memory descriptor blob");
+            return blob;
+        }
+
     private:
 #ifdef DNNL_EXPERIMENTAL_SPARSE
         memory::data_type query_data_type(query what, int index) const {
@@ -3139,6 +3287,31 @@ struct memory : public handle<dnnl_memory_t> {
         : memory(md, aengine, DNNL_MEMORY_ALLOCATE) {}
 #endif
 
+    /// Creates a read-only memory object backed by a mapping of a file.
+    ///
+    /// The contents of the file starting at @p offset are used as the memory
+    /// buffer without being copied and are read in on the first access. The
+    /// file must hold the data in the layout described by @p md. The memory
+    /// object may be passed to primitives as an input only.
+    ///
+    /// @note
+    ///     Only CPU engines with a native runtime on POSIX systems are
+    ///     supported.
+    ///
+    /// @param md Memory descriptor.
+    /// @param aengine Engine to use.
+    /// @param fd File descriptor of a file opened for reading.
+    /// @param offset Offset of the data in the file in bytes.
+    /// @returns Memory object.
+    static memory from_file(
+            const desc &md, const engine &aengine, int fd, size_t offset = 0) {
+        dnnl_memory_t result;
+        error::wrap_c_api(dnnl_memory_create_from_file(
+                                  &result, md.get(), aengine.get(), fd, offset),
+                "could not create a memory object from a file");
+        return memory(result);
+    }
+
     /// Returns the associated memory descriptor.
     desc get_desc() const {
         const_dnnl_memory_desc_t cdesc;
@@ -3669,6 +3842,41 @@ struct post_ops : public handle<dnnl_post_ops_t> {
         error::wrap_c_api(dnnl_post_ops_get_params_prelu(get(), index, &mask),
                 "could not get parameters of a binary post-op");
     }
+
+    /// Appends a gated linear unit (GLU) post-op.
+    ///
+    /// The operation result is split along the last dimension into a gate
+    /// half and an up half and the post-op computes:
+    ///
+    ///     dst[..., n] <- eltwise_op(res[..., n]) * res[..., n + N]
+    ///
+    /// For example, SwiGLU uses #dnnl::algorithm::eltwise_swish with alpha
+    /// equal to 1. The post-op is supported by the matmul primitive only and
+    /// must be the first post-op in the chain.
+    ///
+    /// @param aalgorithm Elementwise algorithm applied to the gate half.
+    /// @param alpha Alpha parameter for the elementwise algorithm.
+    /// @param beta Beta parameter for the elementwise algorithm.
+    void append_glu(algorithm aalgorithm, float alpha = 0.f, float beta = 0.f) {
+        error::wrap_c_api(dnnl_post_ops_append_glu(get(),
+                                  convert_to_c(aalgorithm), alpha, beta),
+                "could not append a glu post-op");
+    }
+
+    /// Returns the parameters of a GLU post-op.
+    ///
+    /// @param index Index of the GLU post-op.
+    /// @param aalgorithm Output elementwise algorithm kind.
+    /// @param alpha Output alpha parameter for the elementwise algorithm.
+    /// @param beta Output beta parameter for the elementwise algorithm.
+    void get_params_glu(
+            int index, algorithm &aalgorithm, float &alpha, float &beta) const {
+        dnnl_alg_kind_t c_alg;
+        error::wrap_c_api(dnnl_post_ops_get_params_glu(
+                                  get(), index, &c_alg, &alpha, &beta),
+                "could not get parameters of a glu post-op");
+        aalgorithm = static_cast<dnnl::algorithm>(c_alg);
+    }
 };
 
 /// @cond DO_NOT_DOCUMENT_THIS
@@ -3710,12 +3918,30 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
         return fpmath_mode(result);
     }
 
+    /// Returns the fpmath mode and whether it applies to integer weights.
+    ///
+    /// @param mode Output fpmath mode.
+    /// @param apply_to_int Output flag that controls integer weights
+    ///     up-conversion.
+    void get_fpmath_mode(fpmath_mode &mode, bool &apply_to_int) const {
+        dnnl_fpmath_mode_t c_mode;
+        int c_apply_to_int;
+        error::wrap_c_api(dnnl_primitive_attr_get_fpmath_mode_v2(
+                                  get(), &c_mode, &c_apply_to_int),
+                "could not get fpmath mode primitive attribute");
+        mode = fpmath_mode(c_mode);
+        apply_to_int = static_cast<bool>(c_apply_to_int);
+    }
+
     /// Sets fpmath mode.
     ///
     /// @param mode Specified fpmath mode.
-    void set_fpmath_mode(fpmath_mode mode) {
-        error::wrap_c_api(dnnl_primitive_attr_set_fpmath_mode(
-                                  get(), dnnl::convert_to_c(mode)),
+    /// @param apply_to_int Use floating-point arithmetic for integer
+    ///     weights: they are up-converted to the compute type using the
+    ///     weights scales and zero points.
+    void set_fpmath_mode(fpmath_mode mode, bool apply_to_int = false) {
+        error::wrap_c_api(dnnl_primitive_attr_set_fpmath_mode_v2(get(),
+                                  dnnl::convert_to_c(mode), apply_to_int),
                 "could not set fpmath mode primitive attribute");
     }
 
@@ -3737,6 +3963,26 @@ struct primitive_attr : public handle<dnnl_primitive_attr_t> {
                 "could not set scratchpad mode primitive attribute");
     }
 
+    /// Returns the output selection flag.
+    bool get_output_select() const {
+        int result;
+        error::wrap_c_api(dnnl_primitive_attr_get_output_select(get(), &result),
+                "could not get output select primitive attribute");
+        return result;
+    }
+
+    /// Sets the output selection flag. When set, a matmul primitive computes
+    /// only the destination columns listed in an s32 index array passed at
+    /// execution time as an argument with index #DNNL_ARG_ATTR_OUTPUT_SELECT.
+    ///
+    /// @sa dnnl_primitive_attr_set_output_select
+    ///
+    /// @param value Specified output selection flag.
+    void set_output_select(bool value) {
+        error::wrap_c_api(dnnl_primitive_attr_set_output_select(get(), value),
+                "could not set output select primitive attribute");
+    }
+
     /// Sets scaling factors for primitive operations for a given memory
     /// argument. The scaling factors must be passed at execution time
     /// as an argument with index #DNNL_ARG_ATTR_SCALES | arg.
@@ -13024,6 +13270,240 @@ struct reduction : public primitive {
 
 /// @} dnnl_api_reduction
 
+/// @addtogroup dnnl_api_optimizer Optimizer
+///
+/// A primitive to update weights in place using their gradient with the SGD,
+/// Adam, AdamW, and LAMB algorithms.
+///
+/// @sa @ref dev_guide_optimizer in developer guide
+///
+/// @{
+
+/// Optimizer.
+struct optimizer : public primitive {
+    /// Primitive descriptor for an optimizer primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for an optimizer primitive.
+        ///
+        /// @note
+        ///     Diff weights memory descriptor may be initialized with
+        ///     #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param aalgorithm Optimizer algorithm kind. Possible values:
+        ///     #dnnl::algorithm::optimizer_sgd,
+        ///     #dnnl::algorithm::optimizer_adam,
+        ///     #dnnl::algorithm::optimizer_adamw,
+        ///     #dnnl::algorithm::optimizer_lamb.
+        /// @param weights_desc Weights memory descriptor.
+        /// @param diff_weights_desc Diff weights memory descriptor.
+        /// @param beta_1 Decay rate of the first moment. For
+        ///     #dnnl::algorithm::optimizer_sgd this is the momentum.
+        /// @param beta_2 Decay rate of the second moment.
+        /// @param epsilon Term added to the denominator for numerical
+        ///     stability.
+        /// @param weight_decay Weight decay factor.
+        /// @param flags Optimizer flags. Possible values are
+        ///     #dnnl::optimizer_flags::none or any combination of the flags
+        ///     (see @ref dnnl::optimizer_flags).
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, algorithm aalgorithm,
+                const memory::desc &weights_desc,
+                const memory::desc &diff_weights_desc, float beta_1,
+                float beta_2, float epsilon, float weight_decay,
+                optimizer_flags flags,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status = dnnl_optimizer_primitive_desc_create(&pd,
+                    aengine.get(), convert_to_c(aalgorithm),
+                    weights_desc.get(), diff_weights_desc.get(), beta_1,
+                    beta_2, epsilon, weight_decay, convert_to_c(flags),
+                    attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for an "
+                        "optimizer primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for an optimizer primitive from
+        /// a C API primitive descriptor that must have a matching kind.
+        ///
+        /// @param pd C API primitive descriptor for an optimizer primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(pd, dnnl::primitive::kind::optimizer) {}
+
+        /// @copydoc dnnl::primitive_desc_base::weights_desc()const
+        memory::desc weights_desc() const { return base::weights_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_weights_desc()const
+        memory::desc diff_weights_desc() const {
+            return base::diff_weights_desc(0);
+        }
+
+        /// Returns memory descriptor for master weights.
+        /// @returns Memory descriptor for master weights. A zero memory
+        ///     descriptor is returned if master weights are not used.
+        memory::desc master_weights_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_MASTER_WEIGHTS);
+        }
+
+        /// Returns memory descriptor for the first moment.
+        /// @returns Memory descriptor for the first moment. A zero memory
+        ///     descriptor is returned if the algorithm does not use it.
+        memory::desc moment_1_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_MOMENT_1);
+        }
+
+        /// Returns memory descriptor for the second moment.
+        /// @returns Memory descriptor for the second moment. A zero memory
+        ///     descriptor is returned if the algorithm does not use it.
+        memory::desc moment_2_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_MOMENT_2);
+        }
+
+        /// @copydoc dnnl::primitive_desc_base::get_epsilon()const
+        float get_epsilon() const { return base::get_epsilon(); }
+
+        /// @copydoc dnnl::primitive_desc_base::get_algorithm()const
+        algorithm get_algorithm() const { return base::get_algorithm(); }
+
+        /// Returns optimizer flags.
+        /// @return Optimizer flags.
+        optimizer_flags get_flags() const {
+            return base::get_flags<optimizer_flags>();
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    optimizer() = default;
+
+    /// Constructs an optimizer primitive.
+    /// @param pd Primitive descriptor for an optimizer primitive.
+    optimizer(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs an optimizer primitive from a cache blob.
+    /// @param pd Primitive descriptor for an optimizer primitive.
+    /// @param cache_blob Cache blob.
+    optimizer(const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_optimizer
+
+/// @addtogroup dnnl_api_softmax_cross_entropy Softmax Cross-Entropy
+///
+/// A primitive to compute the cross-entropy loss of the softmax of logits
+/// with respect to integer labels, and optionally the gradient of the loss
+/// with respect to the logits, without materializing the probabilities.
+///
+/// @sa @ref dev_guide_softmax_cross_entropy in developer guide
+///
+/// @{
+
+/// Softmax cross-entropy.
+struct softmax_cross_entropy : public primitive {
+    /// Primitive descriptor for a softmax cross-entropy primitive.
+    struct primitive_desc : public dnnl::primitive_desc {
+        /// Default constructor. Produces an empty object.
+        primitive_desc() = default;
+
+        /// Constructs a primitive descriptor for a softmax cross-entropy
+        /// primitive.
+        ///
+        /// @note
+        ///     Source and diff source memory descriptors may be initialized
+        ///     with #dnnl::memory::format_tag::any value of @p format_tag.
+        ///
+        /// @param aengine Engine to use.
+        /// @param src_desc Source (logits) memory descriptor of shape N x C.
+        /// @param labels_desc Labels memory descriptor of shape N.
+        /// @param dst_desc Destination (per-sample loss) memory descriptor
+        ///     of shape N.
+        /// @param diff_src_desc Diff source memory descriptor. A zero memory
+        ///     descriptor means the gradient is not computed.
+        /// @param label_smoothing Label smoothing factor in the [0, 1)
+        ///     range.
+        /// @param attr Primitive attributes to use. Attributes are optional
+        ///     and default to empty attributes.
+        /// @param allow_empty A flag signifying whether construction is
+        ///     allowed to fail without throwing an exception. In this case an
+        ///     empty object will be produced. This flag is optional and
+        ///     defaults to false.
+        primitive_desc(const engine &aengine, const memory::desc &src_desc,
+                const memory::desc &labels_desc, const memory::desc &dst_desc,
+                const memory::desc &diff_src_desc, float label_smoothing,
+                const primitive_attr &attr = default_attr(),
+                bool allow_empty = false) {
+
+            dnnl_primitive_desc_t pd = nullptr;
+            dnnl_status_t status
+                    = dnnl_softmax_cross_entropy_primitive_desc_create(&pd,
+                            aengine.get(), src_desc.get(), labels_desc.get(),
+                            dst_desc.get(), diff_src_desc.get(),
+                            label_smoothing, attr.get());
+
+            if (!allow_empty)
+                error::wrap_c_api(status,
+                        "could not create a primitive descriptor for a "
+                        "softmax cross-entropy primitive");
+            reset(pd);
+        }
+
+        /// Constructs a primitive descriptor for a softmax cross-entropy
+        /// primitive from a C API primitive descriptor that must have a
+        /// matching kind.
+        ///
+        /// @param pd C API primitive descriptor for a softmax cross-entropy
+        ///     primitive.
+        primitive_desc(dnnl_primitive_desc_t pd)
+            : dnnl::primitive_desc(
+                    pd, dnnl::primitive::kind::softmax_cross_entropy) {}
+
+        /// @copydoc dnnl::primitive_desc_base::src_desc()const
+        memory::desc src_desc() const { return base::src_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::dst_desc()const
+        memory::desc dst_desc() const { return base::dst_desc(0); }
+
+        /// @copydoc dnnl::primitive_desc_base::diff_src_desc()const
+        memory::desc diff_src_desc() const { return base::diff_src_desc(0); }
+
+        /// Returns memory descriptor for labels.
+        /// @returns Memory descriptor for labels.
+        memory::desc labels_desc() const {
+            return query_md(query::exec_arg_md, DNNL_ARG_LABELS);
+        }
+    };
+
+    /// Default constructor. Produces an empty object.
+    softmax_cross_entropy() = default;
+
+    /// Constructs a softmax cross-entropy primitive.
+    /// @param pd Primitive descriptor for a softmax cross-entropy primitive.
+    softmax_cross_entropy(const primitive_desc &pd) : primitive(pd) {}
+
+    /// Constructs a softmax cross-entropy primitive from a cache blob.
+    /// @param pd Primitive descriptor for a softmax cross-entropy primitive.
+    /// @param cache_blob Cache blob.
+    softmax_cross_entropy(
+            const primitive_desc &pd, const std::vector<uint8_t> &cache_blob)
+        : primitive(pd, cache_blob) {}
+};
+
+/// @} dnnl_api_softmax_cross_entropy
+
 /// @} dnnl_api_primitives
 
 /// @addtogroup dnnl_api_service Service
@@ -13309,6 +13789,44 @@ inline void primitive::execute(const stream &astream,
             "could not execute a primitive");
 }
 
+inline void primitive::execute(
+        const stream &astream, const primitive_args &args) const {
+    error::wrap_c_api(
+            dnnl_primitive_execute_bound(get(), astream.get(), args.get()),
+            "could not execute a primitive");
+}
+
+inline primitive_args::primitive_args(const primitive &aprimitive,
+        const std::unordered_map<int, memory> &args) {
+    std::vector<dnnl_exec_arg_t> c_args;
+    c_args.reserve(args.size());
+    for (const auto &a : args)
+        c_args.push_back({a.first, a.second.get(true)});
+
+    dnnl_primitive_args_t result;
+    error::wrap_c_api(dnnl_primitive_args_create(&result, aprimitive.get(),
+                              (int)c_args.size(), c_args.data()),
+            "could not create primitive arguments");
+    reset(result);
+}
+
+inline void exec_plan::begin_capture(const stream &astream) {
+    error::wrap_c_api(dnnl_stream_begin_capture(astream.get()),
+            "could not begin capturing a stream");
+}
+
+inline exec_plan exec_plan::end_capture(const stream &astream) {
+    dnnl_exec_plan_t result;
+    error::wrap_c_api(dnnl_stream_end_capture(astream.get(), &result),
+            "could not end capturing a stream");
+    return exec_plan(result);
+}
+
+inline void exec_plan::execute(const stream &astream) const {
+    error::wrap_c_api(dnnl_exec_plan_execute(get(), astream.get()),
+            "could not execute an execution plan");
+}
+
 /// @endcond
 
 #undef DNNL_DEFINE_BITMASK_OPS
@@ -1886,6 +1886,10 @@ typedef enum {
     dnnl_layer_normalization,
     /// A group normalization primitive.
     dnnl_group_normalization,
+    /// An optimizer primitive.
+    dnnl_optimizer,
+    /// A softmax cross-entropy primitive.
+    dnnl_softmax_cross_entropy,
 
     /// Parameter to allow internal only primitives without undefined behavior.
     /// This parameter is chosen to be valid for so long as sizeof(int) >= 2.
@@ -2042,6 +2046,14 @@ typedef enum {
     dnnl_softmax_accurate = 0x30000,
     /// Logsoftmax
     dnnl_softmax_log,
+    /// Stochastic gradient descent, with an optional momentum
+    dnnl_optimizer_sgd = 0x40000,
+    /// Adam
+    dnnl_optimizer_adam,
+    /// Adam with decoupled weight decay (AdamW)
+    dnnl_optimizer_adamw,
+    /// Layer-wise adaptive moments (LAMB)
+    dnnl_optimizer_lamb,
 } dnnl_alg_kind_t;
 
 /// Flags for normalization primitives.
@@ -2115,6 +2127,25 @@ typedef enum {
 
 } dnnl_normalization_flags_t;
 
+/// Flags for optimizer primitives.
+typedef enum {
+    /// Use no optimizer flags
+    dnnl_optimizer_flags_none = 0x0U,
+
+    /// Use master weights
+    ///
+    /// If specified, the update is applied to an f32 copy of the weights
+    /// (input and output), and the result is written to the weights in their
+    /// data type. Meant for weights kept in a low precision data type.
+    dnnl_optimizer_use_master_weights = 0x1U,
+
+    /// Compute the squared norm of the gradient
+    ///
+    /// If specified, the sum of squares of the scaled gradient is written to
+    /// an extra output.
+    dnnl_optimizer_compute_diff_weights_norm = 0x2U,
+} dnnl_optimizer_flags_t;
+
 /// @} dnnl_api_primitives_common
 /// @} dnnl_api_primitives
 
@@ -2406,6 +2437,19 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for shift argument of normalization primitives.
 #define DNNL_ARG_SHIFT 52
 
+/// Master (f32) copy of the weights argument of optimizer primitives.
+#define DNNL_ARG_MASTER_WEIGHTS 53
+/// First moment (momentum) argument of optimizer primitives.
+#define DNNL_ARG_MOMENT_1 54
+/// Second moment argument of optimizer primitives.
+#define DNNL_ARG_MOMENT_2 55
+/// Learning rate argument of optimizer primitives.
+#define DNNL_ARG_LEARNING_RATE 56
+/// Step number argument of optimizer primitives.
+#define DNNL_ARG_STEP 57
+/// Labels argument of softmax cross-entropy primitives.
+#define DNNL_ARG_LABELS 58
+
 /// Workspace tensor argument. Workspace is used to pass information
 /// from forward propagation to backward propagation computations.
 #define DNNL_ARG_WORKSPACE 64
@@ -2495,9 +2539,16 @@ typedef const struct dnnl_primitive *const_dnnl_primitive_t;
 /// A special mnemonic for shift argument of normalization primitives.
 #define DNNL_ARG_DIFF_SHIFT 256
 
+/// Squared norm of the gradient of the weights argument of optimizer
+/// primitives.
+#define DNNL_ARG_DIFF_WEIGHTS_NORM 257
+
 /// Output scaling factors provided at execution time.
 #define DNNL_ARG_ATTR_OUTPUT_SCALES 513
 
+/// Output selection indices provided at execution time.
+#define DNNL_ARG_ATTR_OUTPUT_SELECT 514
+
 /// Starting index for source arguments for primitives that take a variable
 /// number of source arguments.
 #define DNNL_ARG_MULTIPLE_SRC 1024
@@ -2530,6 +2581,24 @@ typedef struct {
     dnnl_memory_t memory; ///< Input/output memory
 } dnnl_exec_arg_t;
 
+/// @struct dnnl_primitive_args
+/// An opaque structure to describe a set of primitive execution arguments
+/// validated and bound to a primitive ahead of execution.
+struct dnnl_primitive_args;
+/// A primitive arguments handle.
+typedef struct dnnl_primitive_args *dnnl_primitive_args_t;
+/// A constant primitive arguments handle.
+typedef const struct dnnl_primitive_args *const_dnnl_primitive_args_t;
+
+/// @struct dnnl_exec_plan
+/// An opaque structure to describe an immutable sequence of primitive
+/// executions recorded on a stream.
+struct dnnl_exec_plan;
+/// An execution plan handle.
+typedef struct dnnl_exec_plan *dnnl_exec_plan_t;
+/// A constant execution plan handle.
+typedef const struct dnnl_exec_plan *const_dnnl_exec_plan_t;
+
 /// @} dnnl_api_primitives_common
 
 /// @addtogroup dnnl_api_primitives_common
@@ -108,6 +108,20 @@ bool is_per_oc_bcast(const std::bitset<DNNL_MAX_NDIMS> mask,
     return true;
 }
 
+// Checks if rhs arg is a plain view with the layout different from dst one,
+// e.g. a slice of a larger tensor or a transposed tensor.
+bool is_strided_view(
+        const memory_desc_t &rhs_arg_md, const memory_desc_wrapper &dst_d) {
+    const memory_desc_wrapper rhs_arg_d(rhs_arg_md);
+    if (!rhs_arg_d.is_blocking_desc() || !dst_d.is_blocking_desc())
+        return false;
+    if (rhs_arg_d.blocking_desc().inner_nblks != 0) return false;
+
+    return rhs_arg_md.offset0 != dst_d.offset0()
+            || !utils::array_cmp(rhs_arg_d.blocking_desc().strides,
+                    dst_d.blocking_desc().strides, rhs_arg_md.ndims);
+}
+
 bool bcast_strategy_enabled(const bcast_set_t &supported_strategy_set,
         const broadcasting_strategy_t &bcast) {
     return supported_strategy_set.find(bcast) != supported_strategy_set.cend();
@@ -173,6 +187,10 @@ broadcasting_strategy_t get_rhs_arg_broadcasting_strategy(
 
     if (all_ones && is_enabled(broadcasting_strategy_t::scalar))
         bcast = broadcasting_strategy_t::scalar;
+    else if (all_equal
+            && is_enabled(broadcasting_strategy_t::no_broadcast_strided)
+            && is_strided_view(rhs_arg_md, dst_d))
+        bcast = broadcasting_strategy_t::no_broadcast_strided;
     else if (all_equal && is_enabled(broadcasting_strategy_t::no_broadcast))
         bcast = broadcasting_strategy_t::no_broadcast;
     else if (is_per_mb_w_bcast(mask, dst_d)
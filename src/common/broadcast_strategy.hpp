@@ -38,6 +38,7 @@ enum class broadcasting_strategy_t {
     per_w, // [1, 1, 1, 1, w] // Broadcast per width
     shared_axes, // [n, 1, d, h, 1] // General case broadcast (any combination)
     no_broadcast, // [n, c, d, h, w]
+    no_broadcast_strided, // [n, c, d, h, w] with a layout different from dst
     unsupported
 };
 
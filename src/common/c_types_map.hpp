@@ -22,6 +22,8 @@
 // These aliases should be in the global namespace as they are intended
 // to give names that better reflects the meaning of the entities
 using primitive_iface_t = dnnl_primitive;
+using primitive_args_t = dnnl_primitive_args;
+using exec_plan_t = dnnl_exec_plan;
 using primitive_desc_iface_t = dnnl_primitive_desc;
 
 namespace dnnl {
@@ -141,6 +143,10 @@ const alg_kind_t reduction_norm_lp_power_p_sum
         = dnnl_reduction_norm_lp_power_p_sum;
 const alg_kind_t softmax_accurate = dnnl_softmax_accurate;
 const alg_kind_t softmax_log = dnnl_softmax_log;
+const alg_kind_t optimizer_sgd = dnnl_optimizer_sgd;
+const alg_kind_t optimizer_adam = dnnl_optimizer_adam;
+const alg_kind_t optimizer_adamw = dnnl_optimizer_adamw;
+const alg_kind_t optimizer_lamb = dnnl_optimizer_lamb;
 } // namespace alg_kind
 
 using data_type_t = dnnl_data_type_t;
@@ -1739,6 +1745,14 @@ const normalization_flags_t fuse_norm_relu = dnnl_fuse_norm_relu;
 const normalization_flags_t fuse_norm_add_relu = dnnl_fuse_norm_add_relu;
 } // namespace normalization_flags
 
+using optimizer_flags_t = dnnl_optimizer_flags_t;
+namespace optimizer_flags {
+const optimizer_flags_t none = dnnl_optimizer_flags_none;
+const optimizer_flags_t use_master_weights = dnnl_optimizer_use_master_weights;
+const optimizer_flags_t compute_diff_weights_norm
+        = dnnl_optimizer_compute_diff_weights_norm;
+} // namespace optimizer_flags
+
 using rnn_flags_t = dnnl_rnn_flags_t;
 namespace rnn_flags {
 const rnn_flags_t undef = dnnl_rnn_flags_undef;
@@ -1797,10 +1811,14 @@ const primitive_kind_t reduction = dnnl_reduction;
 const primitive_kind_t softmax = dnnl_softmax;
 const primitive_kind_t layer_normalization = dnnl_layer_normalization;
 const primitive_kind_t group_normalization = dnnl_group_normalization;
+const primitive_kind_t optimizer = dnnl_optimizer;
+const primitive_kind_t softmax_cross_entropy = dnnl_softmax_cross_entropy;
 
 // Internal only primitive kinds.
 const primitive_kind_t internal_only_start = (primitive_kind_t)(1 << 12);
 const primitive_kind_t zero_pad = internal_only_start;
+// Gated linear unit post-op, it has no standalone primitive.
+const primitive_kind_t glu = (primitive_kind_t)(internal_only_start + 1);
 } // namespace primitive_kind
 
 using query_t = dnnl_query_t;
@@ -1942,6 +1960,7 @@ struct lrn_bwd_pd_t;
 struct lrn_fwd_pd_t;
 struct lrn_pd_t;
 struct matmul_pd_t;
+struct optimizer_pd_t;
 struct pooling_bwd_pd_t;
 struct pooling_fwd_pd_t;
 struct pooling_pd_t;
@@ -1956,6 +1975,7 @@ struct shuffle_pd_t;
 struct softmax_bwd_pd_t;
 struct softmax_fwd_pd_t;
 struct softmax_pd_t;
+struct softmax_cross_entropy_pd_t;
 struct sum_pd_t;
 
 } // namespace impl
@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_COMPACT_MEMORY_DESC_HPP
+#define COMMON_COMPACT_MEMORY_DESC_HPP
+
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "common/c_types_map.hpp"
+#include "common/memory_desc.hpp"
+#include "common/type_helpers.hpp"
+#include "common/utils.hpp"
+
+namespace dnnl {
+namespace impl {
+
+// Compact form of a memory descriptor meant for storing descriptors as keys
+// and looking them up. A memory_desc_t always carries arrays sized for
+// DNNL_MAX_NDIMS dimensions, while the compact form keeps only the fields
+// that take part in the comparison of descriptors, packed into storage that
+// is bounded by the actual number of dimensions. The hash is computed once
+// on construction, so comparing compact forms of different descriptors
+// rarely goes beyond comparing two integers.
+//
+// Two compact forms are equal if and only if the descriptors they were built
+// from are equal in the sense of operator==(memory_desc_t, memory_desc_t).
+struct compact_md_t {
+    compact_md_t() = default;
+
+    explicit compact_md_t(const memory_desc_t &md) {
+        const int ndims = md.ndims;
+        data_.reserve(16 + 4 * ndims);
+        data_.push_back(ndims);
+
+        // All zero memory descriptors are equal regardless of the rest of
+        // the fields.
+        if (ndims != 0) {
+            data_.push_back((dim_t)md.data_type);
+            data_.push_back(md.offset0);
+            data_.push_back((dim_t)md.format_kind);
+            append(md.dims, ndims);
+            append(md.padded_dims, ndims);
+            append(md.padded_offsets, ndims);
+            append_extra(md.extra);
+            append_format_desc(md);
+        }
+
+        hash_ = 0;
+        for (const auto &v : data_)
+            hash_ = hash_combine(hash_, v);
+    }
+
+    size_t hash() const { return hash_; }
+
+    bool operator==(const compact_md_t &other) const {
+        return hash_ == other.hash_ && data_ == other.data_;
+    }
+    bool operator!=(const compact_md_t &other) const {
+        return !operator==(other);
+    }
+
+private:
+    std::vector<dim_t> data_;
+    size_t hash_ = 0;
+
+    template <typename T>
+    void append(const T *v, int n) {
+        for (int i = 0; i < n; ++i)
+            data_.push_back((dim_t)v[i]);
+    }
+
+    void append_extra(const memory_extra_desc_t &extra) {
+        using namespace memory_extra_flags;
+        const bool rnn_s8s8
+                = types::extra_flag_rnn_s8s8_compensation_is_set(extra.flags);
+        data_.push_back((dim_t)extra.flags);
+        if ((extra.flags & compensation_conv_s8s8)
+                || ((extra.flags & rnn_u8s8_compensation) && !rnn_s8s8))
+            data_.push_back(extra.compensation_mask);
+        if ((extra.flags & scale_adjust) && !rnn_s8s8) {
+            uint32_t bits = 0;
+            std::memcpy(&bits, &extra.scale_adjust, sizeof(bits));
+            data_.push_back(bits);
+        }
+        if (extra.flags & compensation_conv_asymmetric_src)
+            data_.push_back(extra.asymm_compensation_mask);
+    }
+
+    void append_format_desc(const memory_desc_t &md) {
+        switch ((int)md.format_kind) {
+            case format_kind::blocked: {
+                const auto &blk = md.format_desc.blocking;
+                // The stride of a dimension of size 1 does not matter.
+                for (int d = 0; d < md.ndims; ++d) {
+                    const bool is_trivial
+                            = md.dims[d] == 1 && md.padded_dims[d] == 1;
+                    data_.push_back(is_trivial ? 0 : blk.strides[d]);
+                }
+                data_.push_back(blk.inner_nblks);
+                append(blk.inner_blks, blk.inner_nblks);
+                append(blk.inner_idxs, blk.inner_nblks);
+                break;
+            }
+            case format_kind::wino: {
+                const auto &wino = md.format_desc.wino_desc;
+                data_.push_back((dim_t)wino.wino_format);
+                data_.push_back(wino.r);
+                data_.push_back(wino.alpha);
+                data_.push_back(wino.ic);
+                data_.push_back(wino.oc);
+                data_.push_back(wino.ic_block);
+                data_.push_back(wino.oc_block);
+                data_.push_back(wino.ic2_block);
+                data_.push_back(wino.oc2_block);
+                break;
+            }
+            case format_kind::rnn_packed: {
+                const auto &rnn = md.format_desc.rnn_packed_desc;
+                data_.push_back((dim_t)rnn.format);
+                data_.push_back(rnn.ldb);
+                data_.push_back(rnn.n_parts);
+                data_.push_back((dim_t)rnn.offset_compensation);
+                data_.push_back((dim_t)rnn.size);
+                data_.push_back(rnn.n);
+                append(rnn.parts, rnn.n_parts);
+                append(rnn.part_pack_size, rnn.n_parts);
+                break;
+            }
+            case format_kind::sparse: {
+                const auto &sparse = md.format_desc.sparse_desc;
+                data_.push_back((dim_t)sparse.encoding);
+                data_.push_back(sparse.nnz);
+                append(sparse.metadata_types,
+                        sparse_desc_t::max_metadata_types);
+                break;
+            }
+            default: break;
+        }
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+namespace std {
+template <>
+struct hash<dnnl::impl::compact_md_t> {
+    size_t operator()(const dnnl::impl::compact_md_t &md) const {
+        return md.hash();
+    }
+};
+} // namespace std
+
+#endif
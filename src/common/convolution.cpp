@@ -210,6 +210,17 @@ status_t conv_attr_check(const convolution_desc_t &desc, const engine_t *engine,
             VCHECK_CONV_UNIMPL(po.check_sum_consistency(dst_dt, is_int8, true),
                     VERBOSE_UNSUPPORTED_POSTOP);
         }
+    } else if (desc.prop_kind == prop_kind::backward_weights
+            && engine->kind() == engine_kind::cpu) {
+        // A sum post-op requests accumulation into diff_weights and
+        // diff_bias instead of overwriting them.
+        VCHECK_CONV_UNIMPL(attr->has_default_values(smask_t::post_ops),
+                VERBOSE_UNSUPPORTED_ATTR);
+
+        const auto &po = attr->post_ops_;
+        VCHECK_CONV_UNIMPL(po.len() == 1 && po.entry_[0].is_sum()
+                        && po.entry_[0].sum.dt == data_type::undef,
+                VERBOSE_UNSUPPORTED_POSTOP);
     } else {
         VCHECK_CONV_UNIMPL(false, VERBOSE_UNSUPPORTED_ATTR);
     }
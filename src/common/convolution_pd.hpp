@@ -451,6 +451,12 @@ struct convolution_bwd_weights_pd_t : public convolution_pd_t {
     int n_inputs() const override { return 2; }
     int n_outputs() const override { return 1 + with_bias(); }
 
+    // With a sum post-op the computed gradients are added to the contents of
+    // diff_weights and diff_bias instead of overwriting them.
+    bool with_accumulation() const {
+        return attr()->post_ops_.find(primitive_kind::sum) != -1;
+    }
+
 protected:
     memory_desc_t src_md_;
     memory_desc_t diff_weights_md_;
@@ -1607,6 +1607,8 @@ const char *dnnl_prim_kind2str(dnnl_primitive_kind_t v) {
     if (v == dnnl_softmax) return "softmax";
     if (v == dnnl_layer_normalization) return "layer_normalization";
     if (v == dnnl_group_normalization) return "group_normalization";
+    if (v == dnnl_optimizer) return "optimizer";
+    if (v == dnnl_softmax_cross_entropy) return "softmax_cross_entropy";
     if (v == dnnl_primitive_kind_max) return "primitive_kind_max";
     assert(!"unknown prim_kind");
     return "unknown prim_kind";
@@ -1683,6 +1685,10 @@ const char *dnnl_alg_kind2str(dnnl_alg_kind_t v) {
     if (v == dnnl_reduction_norm_lp_power_p_sum) return "reduction_norm_lp_power_p_sum";
     if (v == dnnl_softmax_accurate) return "softmax_accurate";
     if (v == dnnl_softmax_log) return "softmax_log";
+    if (v == dnnl_optimizer_sgd) return "optimizer_sgd";
+    if (v == dnnl_optimizer_adam) return "optimizer_adam";
+    if (v == dnnl_optimizer_adamw) return "optimizer_adamw";
+    if (v == dnnl_optimizer_lamb) return "optimizer_lamb";
     assert(!"unknown alg_kind");
     return "unknown alg_kind";
 }
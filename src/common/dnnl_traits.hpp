@@ -141,6 +141,8 @@ PKIND_TRAITS_INST(binary);
 PKIND_TRAITS_INST(matmul);
 PKIND_TRAITS_INST(resampling);
 PKIND_TRAITS_INST(reduction);
+PKIND_TRAITS_INST(optimizer);
+PKIND_TRAITS_INST(softmax_cross_entropy);
 #undef PKIND_TRAITS_INST
 
 } // namespace impl
@@ -0,0 +1,125 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "dnnl_thread.hpp"
+#include "engine.hpp"
+#include "exec_plan.hpp"
+#if defined(DNNL_ENABLE_ITT_TASKS)
+#include "ittnotify.hpp"
+#endif
+#include "primitive_iface.hpp"
+#include "stream.hpp"
+#include "utils.hpp"
+#include "verbose.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+
+dnnl_exec_plan::~dnnl_exec_plan() {
+    for (auto &e : entries_)
+        const_cast<primitive_iface_t *>(e.primitive_iface)->release();
+}
+
+void dnnl_exec_plan::append(
+        const primitive_iface_t *primitive_iface, const exec_args_t &args) {
+    const_cast<primitive_iface_t *>(primitive_iface)->retain();
+    entries_.push_back({primitive_iface, args});
+}
+
+namespace {
+// Running consecutive primitives as team tasks within one parallel region
+// requires a barrier between them. Per-primitive profiling, tracing and msan
+// unpoisoning only happen on the regular execution path.
+bool team_execution_enabled() {
+    if (!dnnl_thr_syncable() || msan_enabled) return false;
+    if (get_verbose(verbose_t::exec_profile)) return false;
+#if defined(DNNL_ENABLE_ITT_TASKS)
+    if (itt::get_itt(itt::__itt_task_level_low)) return false;
+#endif
+    return true;
+}
+} // namespace
+
+status_t dnnl_exec_plan::execute(stream_t *stream) const {
+    status_t status = success;
+    const bool use_team = team_execution_enabled();
+
+    // The whole plan is submitted as a single execution, so the stream hooks
+    // (e.g. threadpool activation) run once rather than once per primitive.
+    stream->before_exec_hook();
+    for (size_t i = 0; i < entries_.size() && status == success;) {
+        std::vector<exec_ctx_t> ctxs;
+        std::vector<team_task_t> tasks;
+        for (; use_team && i < entries_.size(); ++i) {
+            const auto &e = entries_[i];
+            exec_ctx_t ctx(stream, e.args);
+            team_task_t task;
+            if (e.primitive_iface->get_team_task(ctx, task) != success) break;
+            ctxs.push_back(std::move(ctx));
+            tasks.push_back(std::move(task));
+        }
+
+        if (!tasks.empty()) {
+            // Consecutive team tasks share a single parallel region, which
+            // replaces a fork and join per primitive with a barrier.
+            parallel(0, [&](const int ithr, const int nthr) {
+                for (size_t t = 0; t < tasks.size(); ++t) {
+                    if (t > 0) dnnl_thr_barrier();
+                    tasks[t](ithr, nthr);
+                }
+            });
+            for (const auto &ctx : ctxs)
+                ctx.update_zero_padding_state();
+            continue;
+        }
+
+        exec_ctx_t ctx(stream, entries_[i].args);
+        status = primitive_execute(entries_[i].primitive_iface, ctx);
+        ++i;
+    }
+    stream->after_exec_hook();
+
+    return status;
+}
+
+status_t dnnl_stream_begin_capture(stream_t *stream) {
+    if (stream == nullptr) return invalid_arguments;
+    if (stream->engine()->kind() != engine_kind::cpu) return unimplemented;
+    return stream->begin_capture();
+}
+
+status_t dnnl_stream_end_capture(stream_t *stream, exec_plan_t **exec_plan) {
+    if (utils::any_null(stream, exec_plan)) return invalid_arguments;
+    return stream->end_capture(exec_plan);
+}
+
+status_t dnnl_exec_plan_execute(
+        const exec_plan_t *exec_plan, stream_t *stream) {
+    bool ok = !utils::any_null(exec_plan, stream)
+            && exec_plan->engine() == stream->engine()
+            && !stream->is_capturing();
+    if (!ok) return invalid_arguments;
+
+    return exec_plan->execute(stream);
+}
+
+status_t dnnl_exec_plan_destroy(exec_plan_t *exec_plan) {
+    delete exec_plan;
+    return success;
+}
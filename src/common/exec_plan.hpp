@@ -0,0 +1,58 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_EXEC_PLAN_HPP
+#define COMMON_EXEC_PLAN_HPP
+
+#include <vector>
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_exec_types.hpp"
+#include "utils.hpp"
+
+// dnnl_exec_plan is a user facing entity that has an alias exec_plan_t for
+// internal use. It holds a sequence of primitive executions recorded on a
+// stream in capture mode. The arguments of every execution are converted and
+// validated at capture time, so replaying the plan only runs the primitives.
+//
+// Note: the plan keeps the captured primitives alive, but not the memory
+// objects passed to them.
+struct dnnl_exec_plan : public dnnl::impl::c_compatible {
+    dnnl_exec_plan(dnnl::impl::engine_t *engine) : engine_(engine) {}
+    ~dnnl_exec_plan();
+
+    dnnl::impl::engine_t *engine() const { return engine_; }
+    size_t size() const { return entries_.size(); }
+
+    void append(const primitive_iface_t *primitive_iface,
+            const dnnl::impl::exec_args_t &args);
+    dnnl::impl::status_t execute(dnnl::impl::stream_t *stream) const;
+
+private:
+    struct entry_t {
+        const primitive_iface_t *primitive_iface;
+        dnnl::impl::exec_args_t args;
+    };
+
+    dnnl::impl::engine_t *engine_;
+    std::vector<entry_t> entries_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_exec_plan);
+};
+
+#endif
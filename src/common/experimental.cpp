@@ -20,7 +20,7 @@ namespace dnnl {
 namespace impl {
 namespace experimental {
 
-// Bnorm expermental feature: calculate mean & variance in single pass over
+// Bnorm experimental feature: calculate mean & variance in single pass over
 // input tensor. Improves performance by 25-33% but uses numerically unstable
 // formula.
 bool DNNL_API use_bnorm_stats_one_pass() {
@@ -33,6 +33,20 @@ bool DNNL_API use_bnorm_stats_one_pass() {
     return stats_onepass_algo;
 }
 
+// Zero padding experimental feature: track whether the padded area of a memory
+// object is known to hold zeros and skip zeroing it again before a producer
+// that writes only the non-padded area. Relies on the user not writing to the
+// padded area through a raw data handle.
+bool DNNL_API use_lazy_zero_padding() {
+#ifdef DNNL_EXPERIMENTAL
+    static const bool lazy_zero_padding
+            = getenv_int_user("EXPERIMENTAL_LAZY_ZERO_PADDING", 1);
+#else
+    static const bool lazy_zero_padding = false;
+#endif
+    return lazy_zero_padding;
+}
+
 } // namespace experimental
 } // namespace impl
 } // namespace dnnl
@@ -21,6 +21,7 @@ namespace impl {
 namespace experimental {
 
 bool use_bnorm_stats_one_pass();
+bool use_lazy_zero_padding();
 
 } // namespace experimental
 } // namespace impl
@@ -131,6 +131,13 @@
     { nullptr }
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_OPTIMIZER
+#define REG_OPTIMIZER_P(...) __VA_ARGS__
+#else
+#define REG_OPTIMIZER_P(...) \
+    { nullptr }
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_POOLING
 #define REG_POOLING_P(...) __VA_ARGS__
 #else
@@ -187,6 +194,13 @@
     {}
 #endif
 
+#if BUILD_PRIMITIVE_ALL || BUILD_SOFTMAX_CROSS_ENTROPY
+#define REG_SOFTMAX_CROSS_ENTROPY_P(...) __VA_ARGS__
+#else
+#define REG_SOFTMAX_CROSS_ENTROPY_P(...) \
+    { nullptr }
+#endif
+
 #if BUILD_PRIMITIVE_ALL || BUILD_SUM
 #define REG_SUM_P(...) __VA_ARGS__
 #else
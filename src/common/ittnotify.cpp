@@ -70,6 +70,8 @@ __itt_domain *itt_domain(primitive_kind_t kind) {
             CASE(softmax),
             CASE(layer_normalization),
             CASE(group_normalization),
+            CASE(optimizer),
+            CASE(softmax_cross_entropy),
     };
 #undef CASE
 
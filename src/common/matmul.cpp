@@ -46,14 +46,21 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
 
     // Check attributes
     const data_type_t src_dt = desc.src_desc.data_type;
+    const data_type_t wei_dt = desc.weights_desc.data_type;
     const data_type_t dst_dt = desc.dst_desc.data_type;
 
     // Matmul supports scales for floating point data types
-    auto attr_mask
-            = smask_t::post_ops | smask_t::sum_dt | smask_t::scales_runtime;
+    auto attr_mask = smask_t::post_ops | smask_t::sum_dt
+            | smask_t::scales_runtime | smask_t::output_select;
 
     const bool is_int8 = utils::one_of(src_dt, data_type::s8, data_type::u8);
-    if (is_int8) attr_mask |= smask_t::zero_points_runtime;
+    // Integer weights decompression: weights are up-converted to a floating
+    // point type using weights scales and zero points.
+    const bool is_wei_decomp = attr->fpmath_apply_to_int_
+            && utils::one_of(wei_dt, data_type::s8, data_type::u8)
+            && utils::one_of(
+                    src_dt, data_type::f32, data_type::bf16, data_type::f16);
+    if (is_int8 || is_wei_decomp) attr_mask |= smask_t::zero_points_runtime;
 
     VCHECK_MATMUL_UNIMPL(attr->has_default_values(attr_mask, dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
@@ -79,14 +86,23 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         zp.get(DNNL_ARG_WEIGHTS, &mask_wei);
         zp.get(DNNL_ARG_DST, &mask_dst);
 
-        VCHECK_MATMUL_UNIMPL(mask_wei == 0
-                        && (mask_src == 0
-                                || (desc.src_desc.ndims == 2
-                                        && mask_src == 1 << 1))
-                        && (mask_dst == 0
-                                || (desc.dst_desc.ndims == 2
-                                        && mask_dst == 1 << 1)),
-                VERBOSE_UNSUPPORTED_ZP_CFG);
+        if (is_wei_decomp) {
+            // Only weights zero points make sense for decompression.
+            VCHECK_MATMUL_UNIMPL(zp.has_default_values(DNNL_ARG_SRC)
+                            && zp.has_default_values(DNNL_ARG_DST)
+                            && utils::one_of(mask_wei, 0,
+                                    1 << (desc.weights_desc.ndims - 1)),
+                    VERBOSE_UNSUPPORTED_ZP_CFG);
+        } else {
+            VCHECK_MATMUL_UNIMPL(mask_wei == 0
+                            && (mask_src == 0
+                                    || (desc.src_desc.ndims == 2
+                                            && mask_src == 1 << 1))
+                            && (mask_dst == 0
+                                    || (desc.dst_desc.ndims == 2
+                                            && mask_dst == 1 << 1)),
+                    VERBOSE_UNSUPPORTED_ZP_CFG);
+        }
     }
 
     // Check post-ops
@@ -94,7 +110,16 @@ status_t matmul_attr_check(const matmul_desc_t &desc, const engine_t *engine,
         const auto &po = attr->post_ops_;
         using namespace primitive_kind;
         VCHECK_MATMUL_UNIMPL(
-                po.has_default_values({binary, eltwise, prelu, sum}),
+                po.has_default_values({binary, eltwise, prelu, sum, glu}),
+                VERBOSE_UNSUPPORTED_POSTOP);
+
+        // Check GLU: it changes the shape of the result, so it has to be the
+        // first and the only one.
+        const int glu_idx = po.find(glu);
+        VCHECK_MATMUL_UNIMPL(IMPLICATION(glu_idx != -1,
+                                     glu_idx == 0 && po.find(glu, 1) == -1
+                                             && !attr->output_select_
+                                             && desc.bias_desc.ndims == 0),
                 VERBOSE_UNSUPPORTED_POSTOP);
 
         // Check sum
@@ -138,8 +163,21 @@ status_t dnnl_matmul_primitive_desc_create(
     const int n_idx = ndims - 1;
     VCHECK_MATMUL(dst_md->dims[m_idx] == src_md->dims[m_idx],
             VERBOSE_INCONSISTENT_DIM, "dst", m_idx, "src", m_idx);
-    VCHECK_MATMUL(dst_md->dims[n_idx] == weights_md->dims[n_idx],
+    // With output selection dst columns are gathered from weights ones, so
+    // only the selected subset of weights columns contributes to dst.
+    const bool with_output_select = attr && attr->output_select_;
+    // With GLU post-op weights produce both gate and up halves of the result.
+    const bool with_glu
+            = attr && attr->post_ops_.find(primitive_kind::glu) != -1;
+    const dim_t wei_n_mult = with_glu ? 2 : 1;
+    VCHECK_MATMUL(IMPLICATION(!with_output_select,
+                          dst_md->dims[n_idx] * wei_n_mult
+                                  == weights_md->dims[n_idx]),
             VERBOSE_INCONSISTENT_DIM, "dst", n_idx, "weights", n_idx);
+    VCHECK_MATMUL(IMPLICATION(with_output_select || with_glu,
+                          !one_of(DNNL_RUNTIME_DIM_VAL, dst_md->dims[n_idx],
+                                  weights_md->dims[n_idx])),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
     VCHECK_MATMUL(src_md->dims[k_idx_src] == weights_md->dims[k_idx_wei],
             VERBOSE_INCONSISTENT_DIM, "src", k_idx_src, "weights", k_idx_wei);
     VCHECK_MATMUL(
@@ -182,8 +220,16 @@ status_t dnnl_matmul_primitive_desc_create(
         }
     }
 
-    op_d.accum_data_type = types::default_accum_data_type(src_md->data_type,
-            weights_md->data_type, dst_md->data_type, prop_kind::forward);
+    // Decompressed integer weights are accumulated in floating point.
+    const bool is_wei_decomp = attr && attr->fpmath_apply_to_int_
+            && one_of(weights_md->data_type, data_type::s8, data_type::u8)
+            && one_of(src_md->data_type, data_type::f32, data_type::bf16,
+                    data_type::f16);
+    op_d.accum_data_type = is_wei_decomp
+            ? data_type::f32
+            : types::default_accum_data_type(src_md->data_type,
+                    weights_md->data_type, dst_md->data_type,
+                    prop_kind::forward);
     VCHECK_MATMUL(op_d.accum_data_type != data_type::undef,
             VERBOSE_INVALID_DATATYPE, "accumulation");
     CHECK(matmul_attr_check(op_d, engine, attr));
@@ -51,6 +51,9 @@ struct matmul_pd_t : public primitive_desc_t {
 
         if (arg == DNNL_ARG_DST) return arg_usage_t::output;
 
+        if (arg == DNNL_ARG_ATTR_OUTPUT_SELECT && with_output_select())
+            return arg_usage_t::input;
+
         return primitive_desc_t::arg_usage(arg);
     }
 
@@ -86,7 +89,8 @@ struct matmul_pd_t : public primitive_desc_t {
     }
 
     int n_inputs() const override {
-        return 2 + with_bias() + n_binary_po_inputs() + n_prelu_po_inputs();
+        return 2 + with_bias() + with_output_select() + n_binary_po_inputs()
+                + n_prelu_po_inputs();
     }
     int n_outputs() const override { return 1; }
 
@@ -105,6 +109,10 @@ struct matmul_pd_t : public primitive_desc_t {
     }
 
     bool with_bias() const { return bias_md_.ndims != 0; }
+    bool with_output_select() const { return attr()->output_select_; }
+    bool with_glu() const {
+        return attr()->post_ops_.find(primitive_kind::glu) != -1;
+    }
     bool batched() const { return ndims() > 2; }
 
     dim_t batch() const {
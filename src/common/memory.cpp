@@ -33,6 +33,10 @@
 #include "type_helpers.hpp"
 #include "utils.hpp"
 
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+#include "cpu/cpu_memory_storage.hpp"
+#endif
+
 using namespace dnnl::impl;
 using namespace dnnl::impl::utils;
 using namespace dnnl::impl::status;
@@ -102,12 +106,14 @@ status_t dnnl_memory::set_data_handle(void *handle, int index) const {
     CHECK(memory_storage(index)->get_data_handle(&old_handle));
     if (handle != old_handle) {
         CHECK(memory_storage(index)->set_data_handle(handle));
+        set_zero_padding_clean(false);
     }
     return status::success;
 }
 
 status_t dnnl_memory::reset_memory_storage(
         std::unique_ptr<dnnl::impl::memory_storage_t> &&memory_storage) {
+    set_zero_padding_clean(false);
     if (memory_storage) {
         if (memory_storages_.empty())
             memory_storages_.emplace_back(std::move(memory_storage));
@@ -201,6 +207,36 @@ status_t dnnl_memory_create_v2(memory_t **memory, const memory_desc_t *md,
     return success;
 }
 
+status_t dnnl_memory_create_from_file(memory_t **memory,
+        const memory_desc_t *md, engine_t *engine, int fd, size_t offset) {
+    if (any_null(memory, md, engine)) return invalid_arguments;
+
+    const auto mdw = memory_desc_wrapper(md);
+    if (mdw.format_any() || mdw.has_runtime_dims_or_strides()
+            || mdw.is_sparse_desc())
+        return invalid_arguments;
+
+#if DNNL_CPU_RUNTIME != DNNL_RUNTIME_NONE
+    if (engine->kind() != engine_kind::cpu
+            || !is_native_runtime(engine->runtime_kind()))
+        return unimplemented;
+
+    auto *file_storage = new cpu::cpu_file_memory_storage_t(engine);
+    if (file_storage == nullptr) return out_of_memory;
+    std::unique_ptr<memory_storage_t> storage(file_storage);
+    CHECK(file_storage->map_file(fd, offset, mdw.size()));
+
+    auto _memory = new memory_t(engine, md, std::move(storage));
+    if (_memory == nullptr) return out_of_memory;
+    *memory = _memory;
+    return success;
+#else
+    UNUSED(fd);
+    UNUSED(offset);
+    return unimplemented;
+#endif
+}
+
 status_t dnnl_memory_get_memory_desc(
         const memory_t *memory, const memory_desc_t **md) {
     if (any_null(memory, md)) return invalid_arguments;
@@ -263,6 +299,8 @@ status_t dnnl_memory_map_data_v2(
         return invalid_arguments;
     }
 
+    // The user may write to the padded area through the mapped pointer.
+    memory->set_zero_padding_clean(false);
     return memory->memory_storage(index)->map_data(
             mapped_ptr, nullptr, map_size);
 }
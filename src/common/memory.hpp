@@ -18,6 +18,7 @@
 #define COMMON_MEMORY_HPP
 
 #include <assert.h>
+#include <atomic>
 #include <memory>
 
 #include "oneapi/dnnl/dnnl.h"
@@ -71,7 +72,7 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
     dnnl::impl::memory_storage_t *memory_storage_clean(
             const dnnl::impl::exec_ctx_t &ctx,
             dnnl::impl::status_t &status) const {
-        status = zero_pad(ctx);
+        status = ensure_zero_padded(ctx);
         return memory_storage(0);
     }
 
@@ -86,11 +87,27 @@ struct dnnl_memory : public dnnl::impl::c_compatible {
     /** zeros padding */
     dnnl::impl::status_t zero_pad(const dnnl::impl::exec_ctx_t &ctx) const;
 
+    /** zeros padding unless it is known to hold zeros already; to be used
+     * before a producer that writes only the non-padded area */
+    dnnl::impl::status_t ensure_zero_padded(
+            const dnnl::impl::exec_ctx_t &ctx) const;
+
+    /** returns whether the padded area is known to hold zeros */
+    bool is_zero_padding_clean() const { return zero_padding_clean_; }
+    void set_zero_padding_clean(bool clean) const {
+        zero_padding_clean_ = clean;
+    }
+
     dnnl::impl::status_t reset_memory_storage(
             std::unique_ptr<dnnl::impl::memory_storage_t> &&memory_storage);
 
     size_t get_num_handles() const { return memory_storages_.size(); }
 
+    /** returns whether the memory may be used as an input only */
+    bool is_read_only() const {
+        return memory_storage() && memory_storage()->is_read_only();
+    }
+
 protected:
     dnnl::impl::engine_t *engine_;
     const dnnl::impl::memory_desc_t md_;
@@ -101,6 +118,11 @@ private:
 
     // Number of storages is larger than 1 only for sparse memory.
     std::vector<std::unique_ptr<dnnl::impl::memory_storage_t>> memory_storages_;
+
+    // Set once the padded area is zeroed and reset by anything that may write
+    // to it: a primitive that does not zero pad the memory, changing the
+    // data handle or mapping the memory.
+    mutable std::atomic<bool> zero_padding_clean_ {false};
 };
 
 #endif
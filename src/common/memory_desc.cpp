@@ -15,12 +15,14 @@
 *******************************************************************************/
 
 #include <cctype>
+#include <cstring>
 
 #include "oneapi/dnnl/dnnl.hpp"
 
 #include "common/c_types_map.hpp"
 #include "common/memory_desc.hpp"
 #include "common/memory_desc_wrapper.hpp"
+#include "common/serialization.hpp"
 #include "common/type_helpers.hpp"
 #include "common/utils.hpp"
 
@@ -697,6 +699,75 @@ status_t dnnl_memory_desc_clone(memory_desc_t **memory_desc,
     return success;
 }
 
+namespace {
+// A memory descriptor blob starts with the version of the library that
+// created it: the serialized form of a descriptor is only guaranteed to be
+// the same within a single build.
+void serialize_blob_header(serialization_stream_t &sstream) {
+    const auto *version = dnnl_version();
+    const size_t hash_len = std::strlen(version->hash);
+    sstream.write(&version->major);
+    sstream.write(&version->minor);
+    sstream.write(&version->patch);
+    sstream.write(&hash_len);
+    sstream.write(version->hash, hash_len);
+}
+
+status_t check_blob_header(deserialization_stream_t &dstream) {
+    const auto *version = dnnl_version();
+    int major = -1, minor = -1, patch = -1;
+    size_t hash_len = 0;
+    if (!dstream.read(&major) || !dstream.read(&minor)
+            || !dstream.read(&patch) || !dstream.read(&hash_len))
+        return invalid_arguments;
+    if (major != version->major || minor != version->minor
+            || patch != version->patch
+            || hash_len != std::strlen(version->hash))
+        return invalid_arguments;
+
+    std::vector<char> hash(hash_len);
+    if (!dstream.read(hash.data(), hash_len)
+            || std::memcmp(hash.data(), version->hash, hash_len) != 0)
+        return invalid_arguments;
+    return success;
+}
+} // namespace
+
+status_t dnnl_memory_desc_get_blob(
+        const memory_desc_t *memory_desc, size_t *size, uint8_t *blob) {
+    if (any_null(memory_desc, size)) return invalid_arguments;
+#ifdef DNNL_EXPERIMENTAL_SPARSE
+    if (memory_desc->format_kind == format_kind::sparse) return unimplemented;
+#endif
+
+    serialization_stream_t sstream;
+    serialize_blob_header(sstream);
+    serialization::serialize_md(sstream, *memory_desc);
+    const auto &data = sstream.get_data();
+
+    if (blob == nullptr) {
+        *size = data.size();
+        return success;
+    }
+    if (*size != data.size()) return invalid_arguments;
+    std::memcpy(blob, data.data(), data.size());
+    return success;
+}
+
+status_t dnnl_memory_desc_create_with_blob(
+        memory_desc_t **memory_desc, size_t size, const uint8_t *blob) {
+    if (any_null(memory_desc, blob)) return invalid_arguments;
+
+    deserialization_stream_t dstream(blob, size);
+    CHECK(check_blob_header(dstream));
+
+    auto md = utils::make_unique<memory_desc_t>();
+    if (!md) return out_of_memory;
+    CHECK(serialization::deserialize_md(dstream, *md));
+    (*memory_desc) = md.release();
+    return success;
+}
+
 // This is an internal API that is used only for testing in benchdnn.
 extern "C" status_t DNNL_API dnnl_memory_desc_create_with_string_tag(
         memory_desc_t **memory_desc, int ndims, const dims_t dims,
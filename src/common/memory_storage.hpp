@@ -65,6 +65,9 @@ struct memory_storage_t : public c_compatible {
 
     virtual bool is_host_accessible() const { return false; }
 
+    /** returns true if the underlying data must not be written to */
+    virtual bool is_read_only() const { return false; }
+
     /** returns slice of memory storage
      *
      * @note: sub-storage lifetime shall not exceed one of the base memory storage
@@ -18,6 +18,7 @@
 
 #include "dnnl_thread.hpp"
 #include "dnnl_traits.hpp"
+#include "experimental.hpp"
 #include "stream.hpp"
 #include "type_helpers.hpp"
 #include "utils.hpp"
@@ -312,9 +313,21 @@ status_t memory_t::zero_pad(const exec_ctx_t &ctx) const {
     else
         status = ::zero_pad(this, ctx);
 
+    if (status == success) {
+        set_zero_padding_clean(true);
+        ctx.register_zero_padded(this);
+    }
     return status;
 }
 
+status_t memory_t::ensure_zero_padded(const exec_ctx_t &ctx) const {
+    if (experimental::use_lazy_zero_padding() && is_zero_padding_clean()) {
+        ctx.register_zero_padded(this);
+        return success;
+    }
+    return zero_pad(ctx);
+}
+
 extern "C" dnnl_status_t DNNL_API dnnl_impl_zero_pad(
         const memory_t *memory, stream_t *stream) {
     if (memory == nullptr || stream == nullptr)
@@ -417,6 +417,30 @@ struct reduction_desc_t {
     float p, eps;
 };
 
+// A descriptor of optimizer operation.
+struct optimizer_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_optimizer.
+    primitive_kind_t primitive_kind;
+    // The kind of optimizer algorithm. Possible values:
+    // #dnnl_optimizer_sgd, #dnnl_optimizer_adam, #dnnl_optimizer_adamw,
+    // #dnnl_optimizer_lamb.
+    alg_kind_t alg_kind;
+    // Weights memory descriptor.
+    memory_desc_t weights_desc;
+    // Weights gradient memory descriptor.
+    memory_desc_t diff_weights_desc;
+    // Decay rates of the first and the second moments. For #dnnl_optimizer_sgd
+    // @p beta_1 is the momentum and @p beta_2 is ignored.
+    float beta_1, beta_2;
+    // Term added to the denominator, ignored by #dnnl_optimizer_sgd.
+    float epsilon;
+    // Weight decay factor.
+    float weight_decay;
+    // Flags for the optimizer, see #dnnl_optimizer_flags_t.
+    unsigned flags;
+};
+
 /// A descriptor of a Softmax operation.
 struct softmax_desc_t {
     // The kind of primitive. Used for self-identifying the primitive
@@ -440,6 +464,24 @@ struct softmax_desc_t {
     memory_desc_t diff_dst_desc;
 };
 
+// A descriptor of a softmax cross-entropy operation.
+struct softmax_cross_entropy_desc_t {
+    // The kind of primitive. Used for self-identifying the primitive
+    // descriptor. Must be #dnnl_softmax_cross_entropy.
+    primitive_kind_t primitive_kind;
+    // Source (logits) memory descriptor, N x C.
+    memory_desc_t src_desc;
+    // Labels memory descriptor, N.
+    memory_desc_t labels_desc;
+    // Destination (per-sample loss) memory descriptor, N.
+    memory_desc_t dst_desc;
+    // Source gradient memory descriptor. A zero memory descriptor if the
+    // gradient is not computed.
+    memory_desc_t diff_src_desc;
+    // Label smoothing factor.
+    float label_smoothing;
+};
+
 // A descriptor of a binary operation.
 struct binary_desc_t {
     // The kind of primitive. Used for self-identifying the primitive
@@ -614,6 +656,8 @@ struct op_desc_t {
         resampling_desc_t resampling;
         zero_pad_desc_t zero_pad;
         reduction_desc_t reduction;
+        optimizer_desc_t optimizer;
+        softmax_cross_entropy_desc_t softmax_cross_entropy;
     };
 
 #define DECL_CTOR_AND_CONVERTERS(c_type) \
@@ -646,6 +690,8 @@ struct op_desc_t {
     DECL_CTOR_AND_CONVERTERS(resampling_desc_t);
     DECL_CTOR_AND_CONVERTERS(zero_pad_desc_t);
     DECL_CTOR_AND_CONVERTERS(reduction_desc_t);
+    DECL_CTOR_AND_CONVERTERS(optimizer_desc_t);
+    DECL_CTOR_AND_CONVERTERS(softmax_cross_entropy_desc_t);
 
     // concat_desc_t and sum_desc_t have data members which have non-trivial
     // special member functions hence the default destructor is implicitly
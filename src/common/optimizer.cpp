@@ -0,0 +1,128 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::alg_kind;
+
+#define VCHECK_OPTIMIZER(cond, msg, ...) \
+    VCONDCHECK(create, check, optimizer, (cond), status::invalid_arguments, \
+            msg, ##__VA_ARGS__);
+
+#define VCHECK_OPTIMIZER_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(create, check, optimizer, (cond), status::unimplemented, msg, \
+            ##__VA_ARGS__);
+
+namespace {
+status_t optimizer_desc_init(optimizer_desc_t *optimizer_desc,
+        alg_kind_t alg_kind, const memory_desc_t *weights_desc,
+        const memory_desc_t *diff_weights_desc, float beta_1, float beta_2,
+        float epsilon, float weight_decay, unsigned flags) {
+    VCHECK_OPTIMIZER(
+            !any_null(optimizer_desc, weights_desc, diff_weights_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_OPTIMIZER(one_of(alg_kind, optimizer_sgd, optimizer_adam,
+                             optimizer_adamw, optimizer_lamb),
+            VERBOSE_BAD_ALGORITHM);
+
+    const unsigned optimizer_flags = optimizer_flags::use_master_weights
+            | optimizer_flags::compute_diff_weights_norm;
+    VCHECK_OPTIMIZER((~optimizer_flags & flags) == 0, VERBOSE_BAD_FLAGS);
+
+    VCHECK_OPTIMIZER(
+            0.f <= beta_1 && beta_1 < 1.f, VERBOSE_BAD_PARAM, "beta_1");
+    VCHECK_OPTIMIZER(IMPLICATION(alg_kind != optimizer_sgd,
+                             0.f <= beta_2 && beta_2 < 1.f),
+            VERBOSE_BAD_PARAM, "beta_2");
+    VCHECK_OPTIMIZER(epsilon >= 0.f, VERBOSE_BAD_PARAM, "epsilon");
+    VCHECK_OPTIMIZER(weight_decay >= 0.f, VERBOSE_BAD_PARAM, "weight_decay");
+
+    VCHECK_OPTIMIZER(weights_desc->ndims == diff_weights_desc->ndims,
+            VERBOSE_INCONSISTENT_NDIMS, "weights", "diff_weights");
+    VCHECK_OPTIMIZER(array_cmp(weights_desc->dims, diff_weights_desc->dims,
+                             weights_desc->ndims),
+            VERBOSE_INCONSISTENT_DIM, "weights", -1, "diff_weights", -1);
+
+    VCHECK_OPTIMIZER_UNIMPL(
+            !memory_desc_wrapper(weights_desc).has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(diff_weights_desc)
+                                .has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_OPTIMIZER(weights_desc->extra.flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "weights");
+    VCHECK_OPTIMIZER(diff_weights_desc->extra.flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "diff_weights");
+
+    auto od = optimizer_desc_t();
+    od.primitive_kind = primitive_kind::optimizer;
+    od.alg_kind = alg_kind;
+
+    od.weights_desc = *weights_desc;
+    od.diff_weights_desc = *diff_weights_desc;
+    od.beta_1 = beta_1;
+    od.beta_2 = beta_2;
+    od.epsilon = epsilon;
+    od.weight_decay = weight_decay;
+    od.flags = flags;
+
+    *optimizer_desc = od;
+    return success;
+}
+
+status_t optimizer_attr_check(const optimizer_desc_t &desc,
+        const engine_t *engine, const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // Only a common scale of the gradient is supported. It is meant for
+    // unscaling the gradients after mixed precision training with a loss
+    // scale, or for clipping them by a global norm.
+    VCHECK_OPTIMIZER_UNIMPL(attr->has_default_values(smask_t::scales_runtime),
+            VERBOSE_UNSUPPORTED_ATTR);
+    const auto &sc = attr->scales_;
+    VCHECK_OPTIMIZER_UNIMPL(sc.has_default_values({DNNL_ARG_DIFF_WEIGHTS})
+                    && sc.get(DNNL_ARG_DIFF_WEIGHTS).mask_ == 0,
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    return status::success;
+}
+
+} // namespace
+
+dnnl_status_t dnnl_optimizer_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        alg_kind_t alg_kind, const memory_desc_t *weights_desc,
+        const memory_desc_t *diff_weights_desc, float beta_1, float beta_2,
+        float epsilon, float weight_decay, unsigned flags,
+        const primitive_attr_t *attr) {
+    auto optimizer_desc = optimizer_desc_t();
+    CHECK(optimizer_desc_init(&optimizer_desc, alg_kind, weights_desc,
+            diff_weights_desc, beta_1, beta_2, epsilon, weight_decay, flags));
+    CHECK(optimizer_attr_check(optimizer_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&optimizer_desc, nullptr, attr);
+}
@@ -0,0 +1,177 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef COMMON_OPTIMIZER_PD_HPP
+#define COMMON_OPTIMIZER_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_OPTIMIZER(cond, msg, ...) \
+    VCONDCHECK(create, dispatch, optimizer, (cond), status::unimplemented, \
+            "%s," msg, this->info(engine), ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+struct optimizer_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::optimizer;
+
+    typedef optimizer_pd_t hint_class;
+
+    const optimizer_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    status_t query(query_t what, int idx, void *result) const override {
+        switch (what) {
+            case query::alg_kind:
+                *(alg_kind_t *)result = desc()->alg_kind;
+                break;
+            case query::epsilon_f32:
+                *(float *)result = desc()->epsilon;
+                break;
+            case query::flags: *(uint32_t *)result = desc()->flags; break;
+            default: return primitive_desc_t::query(what, idx, result);
+        }
+        return status::success;
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        // The weights and the optimizer states are updated in place.
+        if (arg == DNNL_ARG_WEIGHTS) return arg_usage_t::output;
+        if (arg == DNNL_ARG_DIFF_WEIGHTS) return arg_usage_t::input;
+        if (arg == DNNL_ARG_LEARNING_RATE) return arg_usage_t::input;
+        if (arg == DNNL_ARG_STEP && use_step()) return arg_usage_t::input;
+        if (arg == DNNL_ARG_MASTER_WEIGHTS && use_master_weights())
+            return arg_usage_t::output;
+        if (arg == DNNL_ARG_MOMENT_1 && use_moment_1())
+            return arg_usage_t::output;
+        if (arg == DNNL_ARG_MOMENT_2 && use_moment_2())
+            return arg_usage_t::output;
+        if (arg == DNNL_ARG_DIFF_WEIGHTS_NORM && compute_diff_weights_norm())
+            return arg_usage_t::output;
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_WEIGHTS: return weights_md(0, user_input);
+            case DNNL_ARG_DIFF_WEIGHTS: return diff_weights_md(0, user_input);
+            case DNNL_ARG_MASTER_WEIGHTS:
+                return use_master_weights() ? &state_md_ : &glob_zero_md;
+            case DNNL_ARG_MOMENT_1:
+                return use_moment_1() ? &state_md_ : &glob_zero_md;
+            case DNNL_ARG_MOMENT_2:
+                return use_moment_2() ? &state_md_ : &glob_zero_md;
+            case DNNL_ARG_LEARNING_RATE: return &scalar_md_;
+            case DNNL_ARG_STEP: return use_step() ? &step_md_ : &glob_zero_md;
+            case DNNL_ARG_DIFF_WEIGHTS_NORM:
+                return compute_diff_weights_norm() ? &scalar_md_
+                                                   : &glob_zero_md;
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *weights_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0)
+            return user_input ? &desc()->weights_desc : &weights_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *diff_weights_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0)
+            return user_input ? &desc()->diff_weights_desc : &diff_weights_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 2 + use_step(); }
+    int n_outputs() const override {
+        return 1 + use_master_weights() + use_moment_1() + use_moment_2()
+                + compute_diff_weights_norm();
+    }
+
+    dim_t nelems() const { return memory_desc_wrapper(weights_md_).nelems(); }
+
+    bool use_master_weights() const {
+        return desc_.flags & optimizer_flags::use_master_weights;
+    }
+    bool compute_diff_weights_norm() const {
+        return desc_.flags & optimizer_flags::compute_diff_weights_norm;
+    }
+    // SGD keeps the momentum buffer as the first moment, and does not keep
+    // it at all if the momentum is zero.
+    bool use_moment_1() const {
+        return desc_.alg_kind != alg_kind::optimizer_sgd || desc_.beta_1 != 0.f;
+    }
+    bool use_moment_2() const {
+        return desc_.alg_kind != alg_kind::optimizer_sgd;
+    }
+    // The step number is needed for the bias correction of the moments.
+    bool use_step() const { return use_moment_2(); }
+
+protected:
+    optimizer_desc_t desc_;
+
+    memory_desc_t weights_md_;
+    memory_desc_t diff_weights_md_;
+    // The master weights and the moments: f32 in the layout of the weights.
+    memory_desc_t state_md_;
+    memory_desc_t scalar_md_;
+    memory_desc_t step_md_;
+
+    optimizer_pd_t(const optimizer_desc_t *adesc, const primitive_attr_t *attr,
+            const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , weights_md_(desc_.weights_desc)
+        , diff_weights_md_(desc_.diff_weights_desc)
+        , state_md_(glob_zero_md)
+        , scalar_md_(glob_zero_md)
+        , step_md_(glob_zero_md) {}
+
+    status_t set_default_params() {
+        if (weights_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(weights_md_, nullptr));
+        if (diff_weights_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(
+                    diff_weights_md_, weights_md_.format_desc.blocking));
+        state_md_ = weights_md_;
+        state_md_.data_type = data_type::f32;
+        state_md_.offset0 = 0;
+        CHECK(memory_desc_init_by_blocking_desc(
+                state_md_, weights_md_.format_desc.blocking));
+
+        const dims_t scalar_dims = {1};
+        CHECK(memory_desc_init_by_tag(
+                scalar_md_, 1, scalar_dims, data_type::f32, format_tag::a));
+        CHECK(memory_desc_init_by_tag(
+                step_md_, 1, scalar_dims, data_type::s32, format_tag::a));
+        return status::success;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
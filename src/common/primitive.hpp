@@ -61,6 +61,18 @@ struct primitive_t : public c_compatible {
     primitive_kind_t kind() const { return pd_->kind(); }
     virtual status_t execute(const exec_ctx_t &ctx) const = 0;
 
+    // Returns the part of the execution that threads run in parallel, so that
+    // the caller can run several primitives back to back within one parallel
+    // region, separated by barriers, instead of opening a region per
+    // primitive. Everything the task needs must be resolved from `ctx` here,
+    // on the calling thread: the task must not refer to `ctx`, and must not
+    // rely on zero padding or scratchpad. The data behind the arguments may
+    // be produced by preceding tasks of the same region.
+    virtual status_t get_team_task(
+            const exec_ctx_t &ctx, team_task_t &task) const {
+        return status::unimplemented;
+    }
+
     virtual status_t get_cache_blob(
             engine_t *engine, cache_blob_t &cache_blob) const {
         assert(!"unexpected");
@@ -127,6 +127,8 @@ bool primitive_attr_t::has_default_values(dnnl_primitive_attr::skip_mask_t mask,
             rnn_weights_projection_qparams_);
     CHECK_ARG(IMPLICATION((bool)(~mask & smask_t::sum_dt),
             post_ops_.sum_with_default_dt(dst_dt)));
+    CHECK_ARG(IMPLICATION(
+            (bool)(~mask & smask_t::output_select), !output_select_));
     bool gpu_attr_ok = IMPLICATION((bool)(~mask & smask_t::gpu_attr),
             !gpu_attr_ || gpu_attr_->has_default_values());
     CHECK_ARG(gpu_attr_ok);
@@ -267,6 +269,21 @@ status_t post_ops_t::append_prelu(int mask) {
     return success;
 }
 
+status_t post_ops_t::append_glu(alg_kind_t alg, float alpha, float beta) {
+    if (len() == post_ops_limit) return out_of_memory;
+    if (!math::is_eltwise_ok(data_type::f32, alg, alpha, beta))
+        return invalid_arguments;
+
+    entry_.emplace_back();
+    auto &e = entry_.back();
+    e.kind = primitive_kind::glu;
+    e.glu.scale = 1.f;
+    e.glu.alg = alg;
+    e.glu.alpha = alpha;
+    e.glu.beta = beta;
+    return success;
+}
+
 bool post_ops_t::defined() const {
     for (int idx = 0; idx < len(); ++idx) {
         auto kind = entry_[idx].kind;
@@ -277,6 +294,10 @@ bool post_ops_t::defined() const {
             if (is_runtime_value(e.scale) || is_runtime_value(e.alpha)
                     || is_runtime_value(e.beta))
                 return false;
+        } else if (kind == primitive_kind::glu) {
+            const auto &e = entry_[idx].glu;
+            if (is_runtime_value(e.alpha) || is_runtime_value(e.beta))
+                return false;
         } else if (utils::one_of(kind, primitive_kind::binary,
                            primitive_kind::prelu,
                            primitive_kind::convolution)) {
@@ -352,9 +373,13 @@ bool post_ops_t::check_sum_consistency(const data_type_t dst_dt,
             && check_sum_consistent_quantization(dst_dt, is_int8);
 }
 
-status_t primitive_attr_t::set_fpmath_mode(fpmath_mode_t fpmath_mode) {
+status_t primitive_attr_t::set_fpmath_mode(
+        fpmath_mode_t fpmath_mode, bool apply_to_int) {
     auto st = check_fpmath_mode(fpmath_mode);
-    if (st == success) fpmath_mode_ = fpmath_mode;
+    if (st == success) {
+        fpmath_mode_ = fpmath_mode;
+        fpmath_apply_to_int_ = apply_to_int;
+    }
     return st;
 }
 
@@ -368,6 +393,11 @@ status_t primitive_attr_t::set_scratchpad_mode(
     return success;
 }
 
+status_t primitive_attr_t::set_output_select(bool output_select) {
+    output_select_ = output_select;
+    return success;
+}
+
 status_t primitive_attr_t::set_post_ops(const post_ops_t &post_ops) {
     post_ops_.copy_from(post_ops);
     return status::success;
@@ -406,6 +436,20 @@ status_t dnnl_primitive_attr_destroy(primitive_attr_t *attr) {
     return success;
 }
 
+status_t dnnl_primitive_attr_get_output_select(
+        const primitive_attr_t *attr, int *value) {
+    if (any_null(attr, value)) return invalid_arguments;
+    *value = attr->output_select_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_output_select(
+        primitive_attr_t *attr, int value) {
+    if (any_null(attr)) return invalid_arguments;
+    if (!one_of(value, 0, 1)) return invalid_arguments;
+    return attr->set_output_select(value);
+}
+
 status_t dnnl_primitive_attr_get_fpmath_mode(
         const primitive_attr_t *attr, fpmath_mode_t *mode) {
     if (any_null(attr, mode)) return invalid_arguments;
@@ -419,6 +463,21 @@ status_t dnnl_primitive_attr_set_fpmath_mode(
     return attr->set_fpmath_mode(mode);
 }
 
+status_t dnnl_primitive_attr_get_fpmath_mode_v2(const primitive_attr_t *attr,
+        fpmath_mode_t *mode, int *apply_to_int) {
+    if (any_null(attr, mode)) return invalid_arguments;
+    *mode = attr->fpmath_mode_;
+    if (apply_to_int) *apply_to_int = attr->fpmath_apply_to_int_;
+    return success;
+}
+
+status_t dnnl_primitive_attr_set_fpmath_mode_v2(
+        primitive_attr_t *attr, fpmath_mode_t mode, int apply_to_int) {
+    if (any_null(attr)) return invalid_arguments;
+    if (!one_of(apply_to_int, 0, 1)) return invalid_arguments;
+    return attr->set_fpmath_mode(mode, apply_to_int);
+}
+
 status_t dnnl_primitive_attr_get_scratchpad_mode(
         const primitive_attr_t *attr, scratchpad_mode_t *scratchpad_mode) {
     if (any_null(attr, scratchpad_mode)) return invalid_arguments;
@@ -616,6 +675,26 @@ status_t dnnl_post_ops_get_params_prelu(
     return success;
 }
 
+status_t dnnl_post_ops_append_glu(post_ops_t *post_ops, alg_kind_t alg_kind,
+        float alpha, float beta) {
+    if (post_ops == nullptr) return invalid_arguments;
+
+    return post_ops->append_glu(alg_kind, alpha, beta);
+}
+
+status_t dnnl_post_ops_get_params_glu(const post_ops_t *post_ops, int index,
+        alg_kind_t *alg_kind, float *alpha, float *beta) {
+    if (!simple_get_params_check(post_ops, index, primitive_kind::glu))
+        return invalid_arguments;
+
+    const auto &e = post_ops->entry_[index].glu;
+    if (alg_kind) *alg_kind = e.alg;
+    if (alpha) *alpha = e.alpha;
+    if (beta) *beta = e.beta;
+
+    return success;
+}
+
 status_t dnnl_primitive_attr_set_rnn_data_qparams(
         primitive_attr_t *attr, const float scale, const float shift) {
     if (attr == nullptr) return invalid_arguments;
@@ -294,6 +294,10 @@ private:
         for (const auto &sa : {DNNL_ARG_SRC, DNNL_ARG_WEIGHTS, DNNL_ARG_DST}) {
             if (arg == (DNNL_ARG_ATTR_POST_OP_DW | sa)) return true;
         }
+        // optimizer, see primitive_desc_create()
+        if (arg == DNNL_ARG_DIFF_WEIGHTS) return true;
+        // softmax cross-entropy, see primitive_desc_create()
+        if (arg == DNNL_ARG_DIFF_SRC) return true;
         return false;
     }
 };
@@ -424,6 +428,8 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                 dnnl::impl::data_type_t dt;
             } sum;
             eltwise_t eltwise;
+            // Activation applied to the gate half, scale is always 1.
+            eltwise_t glu;
             depthwise_conv_t depthwise_conv;
             binary_t binary;
             prelu_t prelu;
@@ -466,6 +472,8 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
 
         bool is_like_binary() const { return is_binary() || is_prelu(); }
 
+        bool is_glu() const { return kind == dnnl::impl::primitive_kind::glu; }
+
         dnnl::impl::status_t set_depthwise_scales(const float *scales);
 
         bool operator==(const entry_t &rhs) const {
@@ -473,7 +481,7 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
             using namespace dnnl::impl::utils;
             if (kind != rhs.kind) { return false; }
             bool ret = true;
-            switch (kind) {
+            switch ((int)kind) {
                 case primitive_kind::eltwise:
                     ret = eltwise.alg == rhs.eltwise.alg
                             && equal_with_nan(eltwise.scale, rhs.eltwise.scale)
@@ -507,6 +515,11 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
                 case primitive_kind::prelu:
                     ret = prelu.mask == rhs.prelu.mask;
                     break;
+                case primitive_kind::glu:
+                    ret = glu.alg == rhs.glu.alg
+                            && equal_with_nan(glu.alpha, rhs.glu.alpha)
+                            && equal_with_nan(glu.beta, rhs.glu.beta);
+                    break;
                 default: assert(!"unsupported post_op");
             }
             return ret;
@@ -540,6 +553,8 @@ struct dnnl_post_ops : public dnnl::impl::c_compatible {
     dnnl::impl::status_t append_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *user_src1_desc);
     dnnl::impl::status_t append_prelu(int mask);
+    dnnl::impl::status_t append_glu(
+            dnnl::impl::alg_kind_t alg, float alpha, float beta);
 
     dnnl::impl::status_t prepend_binary(dnnl::impl::alg_kind_t alg,
             const dnnl::impl::memory_desc_t *user_src1_desc);
@@ -642,7 +657,9 @@ private:
 struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl_primitive_attr()
         : scratchpad_mode_(dnnl::impl::scratchpad_mode::library)
-        , fpmath_mode_(dnnl::impl::get_fpmath_mode()) {}
+        , fpmath_mode_(dnnl::impl::get_fpmath_mode())
+        , fpmath_apply_to_int_(false)
+        , output_select_(false) {}
 
     dnnl_primitive_attr *clone() const {
         return new dnnl_primitive_attr(*this);
@@ -661,6 +678,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         zero_points_ = other.zero_points_;
         scratchpad_mode_ = other.scratchpad_mode_;
         fpmath_mode_ = other.fpmath_mode_;
+        fpmath_apply_to_int_ = other.fpmath_apply_to_int_;
+        output_select_ = other.output_select_;
         post_ops_.copy_from(other.post_ops_);
         rnn_data_qparams_ = other.rnn_data_qparams_;
         CHECK(rnn_weights_qparams_.copy_from(other.rnn_weights_qparams_));
@@ -688,7 +707,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         rnn_tparams = 1u << 9,
         sum_dt = 1u << 10,
         rnn_weights_projection_qparams = 1u << 11,
-        gpu_attr = 1u << 12
+        gpu_attr = 1u << 12,
+        output_select = 1u << 13
     };
 
     /** Returns true if the attributes have default values.
@@ -703,6 +723,8 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     bool operator==(const dnnl_primitive_attr &rhs) const {
         bool ret = scratchpad_mode_ == rhs.scratchpad_mode_
                 && fpmath_mode_ == rhs.fpmath_mode_
+                && fpmath_apply_to_int_ == rhs.fpmath_apply_to_int_
+                && output_select_ == rhs.output_select_
                 && output_scales_ == rhs.output_scales_
                 && scales_ == rhs.scales_ && zero_points_ == rhs.zero_points_
                 && post_ops_ == rhs.post_ops_
@@ -717,9 +739,11 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
         return ret;
     }
 
-    dnnl::impl::status_t set_fpmath_mode(dnnl::impl::fpmath_mode_t fpmath_mode);
+    dnnl::impl::status_t set_fpmath_mode(dnnl::impl::fpmath_mode_t fpmath_mode,
+            bool apply_to_int = false);
     dnnl::impl::status_t set_scratchpad_mode(
             dnnl::impl::scratchpad_mode_t scratchpad_mode);
+    dnnl::impl::status_t set_output_select(bool output_select);
     dnnl::impl::status_t set_post_ops(const dnnl::impl::post_ops_t &post_ops);
     dnnl::impl::status_t set_gpu_attr(
             const dnnl::impl::primitive_attr_item_t &gpu_attr);
@@ -754,6 +778,10 @@ struct dnnl_primitive_attr : public dnnl::impl::c_compatible {
     dnnl::impl::zero_points_t zero_points_;
     dnnl::impl::scratchpad_mode_t scratchpad_mode_;
     dnnl::impl::fpmath_mode_t fpmath_mode_;
+    // Integer weights are up-converted to a floating point type and the
+    // fpmath mode applies to the computation.
+    bool fpmath_apply_to_int_;
+    bool output_select_;
     dnnl::impl::post_ops_t post_ops_;
     dnnl::impl::rnn_data_qparams_t rnn_data_qparams_;
     dnnl::impl::scales_t rnn_weights_qparams_;
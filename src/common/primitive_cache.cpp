@@ -14,6 +14,12 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include "primitive_cache.hpp"
 #include "c_types_map.hpp"
 #include "cache_utils.hpp"
@@ -83,7 +89,110 @@ primitive_cache_iface_t primitive_cache() {
     return global_primitive_cache();
 }
 
+// Keys refer to descriptors and attributes they do not own, so each entry
+// keeps its own copies of them. Entries are evicted in the order they were
+// added.
+struct impl_idx_cache_t {
+    using key_t = primitive_hashing::key_t;
+
+    impl_idx_cache_t(int capacity) : capacity_(capacity) {}
+
+    int get(const key_t &key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (capacity_ <= 0) return -1;
+        auto it = entries_.find(key);
+        return it != entries_.end() ? it->second.idx : -1;
+    }
+
+    void add(const key_t &key, int idx) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (capacity_ <= 0) return;
+            // The memoized position is stale if the search did not stop
+            // there, e.g. after the implementation at it declined.
+            auto it = entries_.find(key);
+            if (it != entries_.end()) {
+                it->second.idx = idx;
+                return;
+            }
+        }
+
+        value_t value;
+        value.idx = idx;
+        value.op_desc.reset((op_desc_t *)std::malloc(sizeof(op_desc_t)));
+        if (!value.op_desc) return;
+        copy_c_op_desc(value.op_desc.get(), key.op_desc_);
+        value.attr.reset(new primitive_attr_t(*key.attr_));
+        if (!value.attr->is_initialized()) return;
+
+        key_t own_key = key;
+        own_key.op_desc_ = value.op_desc.get();
+        own_key.attr_ = value.attr.get();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (capacity_ <= 0) return;
+        auto it = entries_.find(own_key);
+        if (it != entries_.end()) {
+            it->second.idx = idx;
+            return;
+        }
+        evict(capacity_ - 1);
+        entries_.emplace(own_key, std::move(value));
+        order_.push_back(own_key);
+    }
+
+    int set_capacity(int capacity) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const int old_capacity = capacity_;
+        capacity_ = capacity;
+        evict(capacity_);
+        return old_capacity;
+    }
+
+private:
+    // Evicts the oldest entries until at most `size` entries are left.
+    void evict(int size) {
+        while ((int)order_.size() > nstl::max(0, size)) {
+            entries_.erase(order_.front());
+            order_.pop_front();
+        }
+    }
+
+    struct op_desc_deleter_t {
+        void operator()(op_desc_t *p) const { std::free(p); }
+    };
+
+    struct value_t {
+        int idx;
+        std::unique_ptr<op_desc_t, op_desc_deleter_t> op_desc;
+        std::unique_ptr<primitive_attr_t> attr;
+    };
+
+    int capacity_;
+    std::mutex mutex_;
+    std::unordered_map<key_t, value_t> entries_;
+    std::deque<key_t> order_;
+};
+
+impl_idx_cache_t &global_impl_idx_cache() {
+    static const int capacity = getenv_int_user("PD_PROBE_CACHE_CAPACITY", 0);
+    static impl_idx_cache_t cache(capacity);
+    return cache;
+}
+
+int impl_idx_cache_iface_t::get(const key_t &key) {
+    return global_impl_idx_cache().get(key);
+}
+
+void impl_idx_cache_iface_t::add(const key_t &key, int idx) {
+    global_impl_idx_cache().add(key, idx);
+}
+
 // Undocumented API, for testing only
+int set_impl_idx_cache_capacity(int capacity) {
+    return global_impl_idx_cache().set_capacity(capacity);
+}
+
 status_t get_primitive_cache_size(int *size) {
     if (size == nullptr) return dnnl::impl::status::invalid_arguments;
     *size = 0;
@@ -60,11 +60,25 @@ private:
 
 primitive_cache_iface_t primitive_cache();
 
+// Positions in implementation lists at which the search for an implementation
+// stopped, memoized by key. The search for the same key is deterministic, so
+// it can start at the memoized position instead of probing all the
+// implementations that precede it. Disabled unless the capacity is set with
+// ONEDNN_PD_PROBE_CACHE_CAPACITY.
+struct impl_idx_cache_iface_t {
+    using key_t = primitive_hashing::key_t;
+
+    // Returns -1 if the position is not known.
+    static int get(const key_t &key);
+    static void add(const key_t &key, int idx);
+};
+
 // Undocumented API for testing.
 status_t DNNL_API get_primitive_cache_size(int *size);
 bool DNNL_API is_primitive_in_cache(const primitive_iface_t *p_iface);
 bool DNNL_API is_pd_in_cache(const primitive_desc_iface_t *pd_iface);
 size_t DNNL_API set_primitive_cache_capacity_without_clearing(size_t capacity);
+int DNNL_API set_impl_idx_cache_capacity(int capacity);
 
 } // namespace impl
 } // namespace dnnl
@@ -29,6 +29,7 @@
 #include "opdesc.hpp"
 #include "primitive_attr.hpp"
 #include "primitive_cache.hpp"
+#include "primitive_hashing.hpp"
 #include "type_helpers.hpp"
 #include "verbose.hpp"
 
@@ -393,6 +394,9 @@ struct primitive_desc_t : public c_compatible {
 
     int pd_iterator_offset() const { return pd_iterator_offset_; }
 
+    // Returns the hash of the descriptor part of the primitive cache key.
+    size_t desc_hash() const { return desc_hash_.get(this); }
+
 protected:
     primitive_attr_t attr_;
     primitive_kind_t kind_;
@@ -402,6 +406,7 @@ protected:
 
     mutable pd_info_t info_;
     mutable cache_blob_id_t cache_blob_id_;
+    mutable primitive_hashing::desc_hash_t desc_hash_;
 
     memory_tracking::registry_t scratchpad_registry_;
 
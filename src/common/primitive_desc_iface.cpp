@@ -40,10 +40,22 @@ status_t primitive_desc_create(primitive_desc_iface_t **primitive_desc_iface,
     const bool known_primitive_kind = utils::one_of(op_desc->kind,
             batch_normalization, binary, convolution, deconvolution, eltwise,
             gemm, group_normalization, inner_product, layer_normalization, lrn,
-            matmul, pooling, prelu, reduction, resampling, rnn, shuffle,
-            softmax);
+            matmul, optimizer, pooling, prelu, reduction, resampling, rnn,
+            shuffle, softmax, softmax_cross_entropy);
     if (!known_primitive_kind) return invalid_arguments;
 
+    // The attributes accept scales of gradients, but only the primitives
+    // that compute or consume the gradients directly support them.
+    if (attr != nullptr) {
+        const auto &sc = attr->scales_;
+        if (op_desc->kind != optimizer
+                && !sc.get(DNNL_ARG_DIFF_WEIGHTS).has_default_values())
+            return invalid_arguments;
+        if (op_desc->kind != softmax_cross_entropy
+                && !sc.get(DNNL_ARG_DIFF_SRC).has_default_values())
+            return invalid_arguments;
+    }
+
     auto pd_iface = utils::make_unique<primitive_desc_iface_t>(engine, op_desc,
             attr, hint_fwd_pd ? hint_fwd_pd->impl().get() : nullptr);
     if (pd_iface == nullptr) return out_of_memory;
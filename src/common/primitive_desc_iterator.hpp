@@ -87,16 +87,24 @@ struct primitive_desc_iterator_t : public c_compatible {
         pd_ = primitive_cache().get_pd(key);
         if (pd_) { return *this; }
 
+        // Skipping an implementation may change where the search stops, so
+        // the memoized positions are used only for full searches.
+        const bool use_idx_cache = skip_idx_ == -1;
+        if (use_idx_cache) {
+            const int cached_idx = impl_idx_cache_iface_t::get(key);
+            if (cached_idx > idx_ && cached_idx <= last_idx_) {
+                const int prev_idx = idx_;
+                idx_ = cached_idx;
+                if (idx_ == last_idx_ || create_pd(idx_)) return *this;
+                idx_ = prev_idx;
+            }
+        }
+
         while (++idx_ != last_idx_) {
             if (idx_ == skip_idx_) continue;
-            primitive_desc_t *candidate_pd = nullptr;
-            auto s = impl_list_[idx_](&candidate_pd, op_desc_, &attr_, engine_,
-                    hint_fwd_pd_, offset_);
-            if (s == status::success) {
-                pd_.reset(candidate_pd);
-                break;
-            }
+            if (create_pd(idx_)) break;
         }
+        if (use_idx_cache) impl_idx_cache_iface_t::add(key, idx_);
         return *this;
     }
 
@@ -119,6 +127,15 @@ protected:
     int offset_;
 
 private:
+    bool create_pd(int idx) {
+        primitive_desc_t *candidate_pd = nullptr;
+        auto s = impl_list_[idx](&candidate_pd, op_desc_, &attr_, engine_,
+                hint_fwd_pd_, offset_);
+        if (s != status::success) return false;
+        pd_.reset(candidate_pd);
+        return true;
+    }
+
     primitive_desc_iterator_t(engine_t *engine, int last_idx)
         : idx_(last_idx)
         , engine_(engine)
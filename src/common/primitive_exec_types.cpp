@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <algorithm>
+
 #include "primitive_exec_types.hpp"
 #include "engine.hpp"
 #include "memory.hpp"
@@ -34,6 +36,7 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
     int n_inputs = 0, extra_inputs = 0;
     int n_outputs = 0, extra_outputs = 0;
 
+    args.reserve(nargs);
     for (int i = 0; i < nargs; ++i) {
         int arg = c_args[i].arg;
         auto *mem = c_args[i].memory;
@@ -65,6 +68,10 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
                                         | DNNL_ARG_ATTR_SCALES | DNNL_ARG_DST));
                 break;
             case primitive_desc_t::arg_usage_t::output:
+                VCONDCHECK(exec, check, primitive, !mem->is_read_only(),
+                        invalid_arguments,
+                        "read-only memory is passed as output argument %d",
+                        arg);
                 args[arg] = {mem, false};
                 n_outputs++;
                 extra_outputs += (arg == DNNL_ARG_SCRATCHPAD);
@@ -89,15 +96,17 @@ status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
 }
 
 memory_t *exec_ctx_t::input(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
-    const auto ma = args_.at(arg);
+    const auto it = args_.find(arg);
+    if (it == args_.end()) return nullptr;
+    const auto &ma = it->second;
     assert(ma.is_const);
     return ma.mem;
 }
 
 memory_t *exec_ctx_t::output(int arg) const {
-    if (args_.count(arg) != 1) return nullptr;
-    const auto ma = args_.at(arg);
+    const auto it = args_.find(arg);
+    if (it == args_.end()) return nullptr;
+    const auto &ma = it->second;
     assert(!ma.is_const);
     return ma.mem;
 }
@@ -109,6 +118,16 @@ status_t exec_ctx_t::zero_pad_output(int arg) const {
     return mem->zero_pad(*this);
 }
 
+void exec_ctx_t::update_zero_padding_state() const {
+    for (const auto &a : args_) {
+        if (a.second.is_const) continue;
+        const auto *mem = a.second.mem;
+        if (std::find(zero_padded_.begin(), zero_padded_.end(), mem)
+                == zero_padded_.end())
+            mem->set_zero_padding_clean(false);
+    }
+}
+
 memory_t *exec_ctx_t::memory(int arg) const {
     assert(args_.count(arg) == 1);
     const auto ma = args_.at(arg);
@@ -126,10 +145,11 @@ void *exec_ctx_t::host_ptr(
     status_t status = status::success;
     if (status_) *status_ = status;
 
-    if (args_.count(arg) != 1) return nullptr;
+    const auto it = args_.find(arg);
+    if (it == args_.end()) return nullptr;
 
-    auto *mem = args_.at(arg).mem;
-    if (do_zeropad) status = mem->zero_pad(*this);
+    auto *mem = it->second.mem;
+    if (do_zeropad) status = mem->ensure_zero_padded(*this);
     if (status_) *status_ = status;
 
     auto *mem_storage = mem->memory_storage(index);
@@ -17,7 +17,12 @@
 #ifndef COMMON_PRIMITIVE_EXEC_TYPES_HPP
 #define COMMON_PRIMITIVE_EXEC_TYPES_HPP
 
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "oneapi/dnnl/dnnl_types.h"
 
@@ -55,17 +60,91 @@ struct memory_arg_t {
 
 struct primitive_desc_t;
 
-using exec_args_t = std::unordered_map<int, memory_arg_t>;
+// A flat associative container for primitive execution arguments.
+//
+// A primitive takes a handful of arguments, so a linear search over a
+// contiguous array is cheaper than hashing, and filling the container costs a
+// single allocation instead of one per argument. The interface mirrors the
+// subset of `std::unordered_map<int, memory_arg_t>` used across the library.
+struct exec_args_t {
+    using value_type = std::pair<int, memory_arg_t>;
+    using iterator = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    exec_args_t() = default;
+    exec_args_t(std::initializer_list<value_type> args) {
+        args_.reserve(args.size());
+        for (const auto &a : args)
+            (*this)[a.first] = a.second;
+    }
+
+    iterator begin() { return args_.begin(); }
+    iterator end() { return args_.end(); }
+    const_iterator begin() const { return args_.begin(); }
+    const_iterator end() const { return args_.end(); }
+
+    size_t size() const { return args_.size(); }
+    bool empty() const { return args_.empty(); }
+    void reserve(size_t n) { args_.reserve(n); }
+    void clear() { args_.clear(); }
+
+    iterator find(int arg) {
+        for (auto it = args_.begin(); it != args_.end(); ++it)
+            if (it->first == arg) return it;
+        return args_.end();
+    }
+    const_iterator find(int arg) const {
+        for (auto it = args_.begin(); it != args_.end(); ++it)
+            if (it->first == arg) return it;
+        return args_.end();
+    }
+
+    size_t count(int arg) const { return find(arg) != end() ? 1 : 0; }
+
+    memory_arg_t &at(int arg) {
+        auto it = find(arg);
+        if (it == end()) throw std::out_of_range("exec_args_t::at");
+        return it->second;
+    }
+    const memory_arg_t &at(int arg) const {
+        auto it = find(arg);
+        if (it == end()) throw std::out_of_range("exec_args_t::at");
+        return it->second;
+    }
+
+    memory_arg_t &operator[](int arg) {
+        auto it = find(arg);
+        if (it != end()) return it->second;
+        args_.emplace_back(arg, memory_arg_t {nullptr, false});
+        return args_.back().second;
+    }
+
+    size_t erase(int arg) {
+        auto it = find(arg);
+        if (it == end()) return 0;
+        args_.erase(it);
+        return 1;
+    }
+
+private:
+    std::vector<value_type> args_;
+};
 
 status_t cvt_primitive_args(const primitive_desc_t *pd, int nargs,
         const dnnl_exec_arg_t *c_args, exec_args_t &args);
 
+// A share of a primitive execution run by thread `ithr` out of `nthr` within
+// a parallel region opened by the caller. See primitive_t::get_team_task().
+using team_task_t = std::function<void(int ithr, int nthr)>;
+
 /** Primitive execution context (helps passing stream, memories, and events. */
 struct resource_mapper_t;
 struct exec_ctx_t {
     explicit exec_ctx_t(stream_t *stream) : stream_(stream) {}
     exec_ctx_t(stream_t *stream, exec_args_t &&args)
         : stream_(stream), args_(std::move(args)) {}
+    exec_ctx_t(stream_t *stream, const exec_args_t &args)
+        : stream_(stream), args_(args) {}
     exec_ctx_t(const exec_ctx_t &other, exec_args_t &&args)
         : stream_(other.stream_)
         , args_(std::move(args))
@@ -81,6 +160,16 @@ struct exec_ctx_t {
 
     status_t zero_pad_output(int arg) const;
 
+    // Records that the padded area of `mem` was zeroed, or found to be zero,
+    // during this execution.
+    void register_zero_padded(const memory_t *mem) const {
+        zero_padded_.push_back(mem);
+    }
+    // Resets the zero padding state of output memory objects that were not
+    // zero padded during this execution, as the primitive may have written
+    // to their padded area.
+    void update_zero_padding_state() const;
+
     void register_memory_mapping(void *handle, void *host_ptr);
 
     void *host_ptr(int arg, bool do_zeropad = false, status_t *status = nullptr,
@@ -131,6 +220,7 @@ private:
     exec_args_t args_;
 
     std::unordered_map<void *, void *> memory_mapping_;
+    mutable std::vector<const memory_t *> zero_padded_;
     const resource_mapper_t *resource_mapper_ = nullptr;
     const memory_tracking::grantor_t *scratchpad_grantor_ = nullptr;
 };
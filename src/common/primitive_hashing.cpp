@@ -29,6 +29,16 @@ namespace primitive_hashing {
 key_t::key_t(const engine_t *engine, const op_desc_t *op_desc,
         const primitive_attr_t *attr, int pd_iterator_offset,
         const std::vector<memory_desc_t> &hint_mds)
+    : key_t(engine, op_desc, attr, pd_iterator_offset, hint_mds,
+            get_desc_hash(op_desc, attr, pd_iterator_offset, hint_mds)) {}
+
+key_t::key_t(const primitive_desc_t *pd, const engine_t *engine)
+    : key_t(engine, pd->op_desc(), pd->attr(), pd->pd_iterator_offset(),
+            pd->hint_mds(false /* is_hint */), pd->desc_hash()) {}
+
+key_t::key_t(const engine_t *engine, const op_desc_t *op_desc,
+        const primitive_attr_t *attr, int pd_iterator_offset,
+        const std::vector<memory_desc_t> &hint_mds, size_t desc_hash)
     : primitive_kind_(op_desc->kind)
     , op_desc_(op_desc)
     , attr_(attr)
@@ -36,23 +46,30 @@ key_t::key_t(const engine_t *engine, const op_desc_t *op_desc,
     , impl_nthr_(dnnl_get_max_threads())
     , hint_mds_(hint_mds)
     , engine_id_(engine->engine_id())
-    , thread_id_(std::this_thread::get_id()) {}
-
-key_t::key_t(const primitive_desc_t *pd, const engine_t *engine)
-    : key_t(engine, pd->op_desc(), pd->attr(), pd->pd_iterator_offset(),
-            pd->hint_mds(false /* is_hint */)) {}
+    , thread_id_(std::this_thread::get_id()) {
+    hash_ = hash_combine(desc_hash, engine_id_.hash());
+    hash_ = hash_combine(hash_, hash_combine(0, impl_nthr_));
+}
 
 bool key_t::operator==(const key_t &rhs) const {
     DNNL_SHORT_CIRCUIT_SELF_COMPARISON(rhs);
     // clang-format off
     bool ret = true
         // Less expensive comparisons come first
+        && hash_ == rhs.hash_
         && primitive_kind_ == rhs.primitive_kind_
         && engine_id_ == rhs.engine_id_
         && hint_mds_.size() == rhs.hint_mds_.size()
         && pd_iterator_offset_ == rhs.pd_iterator_offset_
-        && impl_nthr_ == rhs.impl_nthr_
-        && (*attr_) == (*rhs.attr_);
+        && impl_nthr_ == rhs.impl_nthr_;
+
+    if (!ret) return false;
+
+    // Keys built from the same primitive descriptor, e.g. when a primitive is
+    // created from a primitive descriptor returned by the cache, point to the
+    // same op descriptor and attributes.
+    const bool same_desc = op_desc_ == rhs.op_desc_ && attr_ == rhs.attr_;
+    if (!same_desc) ret = ret && (*attr_) == (*rhs.attr_);
 
     if (!ret) return false;
 
@@ -62,7 +79,7 @@ bool key_t::operator==(const key_t &rhs) const {
                 == cast_to_desc<pkind##_desc_t>(rhs.op_desc_); \
         break;
 
-        switch ((int)primitive_kind_) {
+        if (!same_desc) switch ((int)primitive_kind_) {
             CASE(batch_normalization)
             CASE(binary)
             CASE(concat)
@@ -75,6 +92,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(layer_normalization)
             CASE(lrn)
             CASE(matmul)
+            CASE(optimizer)
             CASE(pooling)
             CASE(prelu)
             CASE(reduction)
@@ -83,6 +101,7 @@ bool key_t::operator==(const key_t &rhs) const {
             CASE(rnn)
             CASE(shuffle)
             CASE(softmax)
+            CASE(softmax_cross_entropy)
             CASE(sum)
             CASE(zero_pad)
             default: assert(!"unknown primitive kind");
@@ -98,6 +117,66 @@ bool key_t::operator==(const key_t &rhs) const {
     return true;
 }
 
+size_t get_desc_hash(const op_desc_t *op_desc, const primitive_attr_t *attr,
+        int pd_iterator_offset, const std::vector<memory_desc_t> &hint_mds) {
+    size_t seed = 0;
+    seed = hash_combine(
+            seed, hash_combine(0, static_cast<size_t>(op_desc->kind)));
+    seed = hash_combine(seed, get_attr_hash(*attr));
+    seed = hash_combine(seed, hash_combine(0, pd_iterator_offset));
+
+    // Combine hash for op_desc with the computed hash
+#define CASE(pkind) \
+    case primitive_kind::pkind: \
+        seed = hash_combine( \
+                seed, get_desc_hash(*(const pkind##_desc_t *)op_desc)); \
+        break;
+
+    // clang-format off
+    switch ((int)op_desc->kind) {
+        CASE(batch_normalization)
+        CASE(binary)
+        CASE(concat)
+        CASE(convolution)
+        CASE(deconvolution)
+        CASE(eltwise)
+        CASE(gemm)
+        CASE(group_normalization)
+        CASE(inner_product)
+        CASE(layer_normalization)
+        CASE(lrn)
+        CASE(matmul)
+        CASE(optimizer)
+        CASE(pooling)
+        CASE(prelu)
+        CASE(reduction)
+        CASE(reorder)
+        CASE(resampling)
+        CASE(rnn)
+        CASE(shuffle)
+        CASE(softmax)
+        CASE(softmax_cross_entropy)
+        CASE(sum)
+        CASE(zero_pad)
+        default: assert(!"unknown primitive_kind");
+    }
+    // clang-format on
+#undef CASE
+
+    seed = get_array_hash(seed, hint_mds.data(), (int)hint_mds.size());
+    return seed;
+}
+
+size_t desc_hash_t::get(const primitive_desc_t *pd) {
+    if (is_initialized_) return hash_;
+    std::call_once(flag_, [&]() {
+        hash_ = get_desc_hash(pd->op_desc(), pd->attr(),
+                pd->pd_iterator_offset(), pd->hint_mds(false /* is_hint */));
+        is_initialized_ = true;
+    });
+    return hash_;
+}
+
 // Combine hash of each memory_desc_t data member
 size_t get_md_hash(const memory_desc_t &md) {
     size_t seed = 0;
@@ -198,6 +277,9 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     seed = hash_combine(seed, static_cast<size_t>(attr.scratchpad_mode_));
     // fpmath_mode
     seed = hash_combine(seed, static_cast<size_t>(attr.fpmath_mode_));
+    seed = hash_combine(seed, attr.fpmath_apply_to_int_);
+    // output_select
+    seed = hash_combine(seed, attr.output_select_);
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -224,7 +306,7 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
     // post_ops: entry[:]
     for (int i = 0; i < attr.post_ops_.len(); i++) {
         const auto &entry = attr.post_ops_.entry_[i];
-        switch (entry.kind) {
+        switch ((int)entry.kind) {
             case primitive_kind::eltwise:
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.eltwise.alg));
@@ -261,6 +343,11 @@ size_t get_attr_hash(const primitive_attr_t &attr) {
                 seed = hash_combine(
                         seed, static_cast<size_t>(entry.prelu.mask));
                 break;
+            case primitive_kind::glu:
+                seed = hash_combine(seed, static_cast<size_t>(entry.glu.alg));
+                seed = hash_combine(seed, entry.glu.alpha);
+                seed = hash_combine(seed, entry.glu.beta);
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -497,6 +584,25 @@ size_t get_desc_hash(const matmul_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const optimizer_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    seed = hash_combine(seed, static_cast<size_t>(desc.alg_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.weights_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_weights_desc));
+    // Hyperparameters
+    seed = hash_combine(seed, desc.beta_1);
+    seed = hash_combine(seed, desc.beta_2);
+    seed = hash_combine(seed, desc.epsilon);
+    seed = hash_combine(seed, desc.weight_decay);
+    // Flags
+    seed = hash_combine(seed, desc.flags);
+    // Combined hash for optimizer desc
+    return seed;
+}
+
 size_t get_desc_hash(const pooling_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -657,6 +763,21 @@ size_t get_desc_hash(const softmax_desc_t &desc) {
     return seed;
 }
 
+size_t get_desc_hash(const softmax_cross_entropy_desc_t &desc) {
+    size_t seed = 0;
+    // Kinds
+    seed = hash_combine(seed, static_cast<size_t>(desc.primitive_kind));
+    // Memory descriptors
+    seed = hash_combine(seed, get_md_hash(desc.src_desc));
+    seed = hash_combine(seed, get_md_hash(desc.labels_desc));
+    seed = hash_combine(seed, get_md_hash(desc.dst_desc));
+    seed = hash_combine(seed, get_md_hash(desc.diff_src_desc));
+    // Label smoothing
+    seed = hash_combine(seed, desc.label_smoothing);
+    // Combined hash for softmax cross-entropy desc
+    return seed;
+}
+
 size_t get_desc_hash(const sum_desc_t &desc) {
     size_t seed = 0;
     // Kinds
@@ -17,6 +17,8 @@
 #ifndef COMMON_PRIMITIVE_HASHING_HPP
 #define COMMON_PRIMITIVE_HASHING_HPP
 
+#include <atomic>
+#include <mutex>
 #include <thread>
 #include <typeindex>
 #include <type_traits>
@@ -41,6 +43,7 @@ struct key_t {
     key_t(const primitive_desc_t *pd, const engine_t *engine);
 
     bool operator==(const key_t &other) const;
+    size_t hash() const { return hash_; }
     const std::thread::id &thread_id() const { return thread_id_; }
     bool has_runtime_dependencies() const {
         return !(engine_id_.kind() == engine_kind::cpu
@@ -58,6 +61,10 @@ struct key_t {
     engine_id_t engine_id_;
 
 private:
+    key_t(const engine_t *engine, const op_desc_t *op_desc,
+            const primitive_attr_t *attr, int pd_iterator_offset,
+            const std::vector<memory_desc_t> &hint_mds, size_t desc_hash);
+
     template <typename desc_t>
     static const desc_t &cast_to_desc(const void *p) {
         return *(reinterpret_cast<const desc_t *>(p));
@@ -65,12 +72,47 @@ private:
 
     static primitive_kind_t get_pkind(primitive_kind_t pkind);
 
+    // The hash is computed once at construction. The part that depends only
+    // on the descriptors is memoized by primitive descriptors (see
+    // `desc_hash_t`), which makes keys built from the same primitive
+    // descriptor cheap.
+    size_t hash_;
+
     // Thread ID is not used as part of the key, it's only used to get
     // information about what thread inserted the key and the corresponding
     // primitive to handle some multithreaded scenarios.
     std::thread::id thread_id_;
 };
 
+// Returns a hash of the descriptor part of a key: primitive kind, op
+// descriptor, attributes, iterator offset and hint memory descriptors.
+size_t get_desc_hash(const op_desc_t *op_desc, const primitive_attr_t *attr,
+        int pd_iterator_offset, const std::vector<memory_desc_t> &hint_mds);
+
+// Memoized `get_desc_hash()` of a primitive descriptor. Primitive descriptors
+// are immutable once created, so the hash is computed on the first primitive
+// creation and reused afterwards.
+struct desc_hash_t {
+    desc_hash_t() : hash_(0), is_initialized_ {false} {}
+    desc_hash_t(const desc_hash_t &other)
+        : hash_(other.is_initialized_ ? other.hash_ : 0)
+        , is_initialized_(other.is_initialized_.load()) {}
+
+    desc_hash_t(desc_hash_t &&other) = delete;
+    desc_hash_t &operator=(const desc_hash_t &other) = delete;
+    desc_hash_t &operator=(desc_hash_t &&other) = delete;
+
+    size_t get(const primitive_desc_t *pd);
+
+private:
+    size_t hash_;
+    std::once_flag flag_;
+
+    // The `std::once_flag` is neither copyable nor movable, so the copy
+    // constructor carries over the state through `is_initialized_`.
+    std::atomic<bool> is_initialized_;
+};
+
 size_t get_md_hash(const memory_desc_t &md);
 size_t get_attr_hash(const primitive_attr_t &attr);
 size_t get_desc_hash(const concat_desc_t &desc);
@@ -84,6 +126,7 @@ size_t get_desc_hash(const inner_product_desc_t &desc);
 size_t get_desc_hash(const layer_normalization_desc_t &desc);
 size_t get_desc_hash(const lrn_desc_t &desc);
 size_t get_desc_hash(const matmul_desc_t &desc);
+size_t get_desc_hash(const optimizer_desc_t &desc);
 size_t get_desc_hash(const pooling_desc_t &desc);
 size_t get_desc_hash(const prelu_desc_t &desc);
 size_t get_desc_hash(const reduction_desc_t &desc);
@@ -92,6 +135,7 @@ size_t get_desc_hash(const resampling_desc_t &desc);
 size_t get_desc_hash(const rnn_desc_t &desc);
 size_t get_desc_hash(const shuffle_desc_t &desc);
 size_t get_desc_hash(const softmax_desc_t &desc);
+size_t get_desc_hash(const softmax_cross_entropy_desc_t &desc);
 size_t get_desc_hash(const sum_desc_t &desc);
 size_t get_desc_hash(const zero_pad_desc_t &desc);
 
@@ -139,56 +183,7 @@ struct hash<dnnl::impl::primitive_hashing::key_t> {
     using argument_type = dnnl::impl::primitive_hashing::key_t;
     using result_type = std::size_t;
     result_type operator()(const argument_type &key) const {
-        using namespace dnnl::impl;
-        using namespace dnnl::impl::primitive_hashing;
-        size_t seed = 0;
-        // Compute hash for primitive_kind_, attr_, impl_id_ and impl_nthr_
-        seed = hash_combine(seed,
-                hash_combine(0, static_cast<size_t>(key.primitive_kind_)));
-        seed = hash_combine(seed, get_attr_hash(*key.attr_));
-        seed = hash_combine(seed, hash_combine(0, key.pd_iterator_offset_));
-        seed = hash_combine(seed, hash_combine(0, key.impl_nthr_));
-
-        seed = hash_combine(seed, key.engine_id_.hash());
-        // Combine hash for op_desc with the computed hash
-#define CASE(pkind) \
-    case primitive_kind::pkind: \
-        seed = hash_combine( \
-                seed, get_desc_hash(*(pkind##_desc_t *)key.op_desc_)); \
-        break;
-
-        // clang-format off
-        switch ((int)key.primitive_kind_) {
-            CASE(batch_normalization)
-            CASE(binary)
-            CASE(concat)
-            CASE(convolution)
-            CASE(deconvolution)
-            CASE(eltwise)
-            CASE(gemm)
-            CASE(group_normalization)
-            CASE(inner_product)
-            CASE(layer_normalization)
-            CASE(lrn)
-            CASE(matmul)
-            CASE(pooling)
-            CASE(prelu)
-            CASE(reduction)
-            CASE(reorder)
-            CASE(resampling)
-            CASE(rnn)
-            CASE(shuffle)
-            CASE(softmax)
-            CASE(sum)
-            CASE(zero_pad)
-            default: assert(!"unknown primitive_kind");
-        }
-            // clang-format on
-#undef CASE
-        seed = get_array_hash(
-                seed, key.hint_mds_.data(), (int)key.hint_mds_.size());
-
-        return seed;
+        return key.hash();
     }
 };
 
@@ -126,6 +126,7 @@ status_t primitive_execute(
 #endif
 
     if (msan_enabled) unpoison_outputs(ctx.args());
+    if (status == success) ctx.update_zero_padding_state();
 
     return status;
 }
@@ -174,21 +175,12 @@ status_t dnnl_primitive_create_from_cache_blob(
             primitive_iface, primitive_desc_iface, cb);
 }
 
-status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
-        stream_t *stream, int nargs, const dnnl_exec_arg_t *c_args) {
-    bool ok = true && !utils::any_null(primitive_iface, stream)
-            && primitive_iface->engine() == stream->engine()
-            && IMPLICATION(nargs > 0, c_args != nullptr);
-    if (!ok) return invalid_arguments;
-
-    exec_args_t args;
-    status_t status = cvt_primitive_args(
-            primitive_iface->pd()->impl().get(), nargs, c_args, args);
-    if (status != status::success) return status;
-
+namespace {
+status_t execute_with_ctx(const primitive_iface_t *primitive_iface,
+        stream_t *stream, exec_ctx_t &ctx) {
+    status_t status = success;
     stream->before_exec_hook();
 
-    exec_ctx_t ctx(stream, std::move(args));
 #ifdef DNNL_ENABLE_STACK_CHECKER
     stack_checker::stack_checker_t sc("dnnl_primitive_execute");
     const auto *pd_iface = primitive_iface->pd();
@@ -205,6 +197,60 @@ status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
 
     return status;
 }
+} // namespace
+
+status_t dnnl_primitive_execute(const primitive_iface_t *primitive_iface,
+        stream_t *stream, int nargs, const dnnl_exec_arg_t *c_args) {
+    bool ok = true && !utils::any_null(primitive_iface, stream)
+            && primitive_iface->engine() == stream->engine()
+            && IMPLICATION(nargs > 0, c_args != nullptr);
+    if (!ok) return invalid_arguments;
+
+    exec_args_t args;
+    status_t status = cvt_primitive_args(
+            primitive_iface->pd()->impl().get(), nargs, c_args, args);
+    if (status != status::success) return status;
+
+    if (stream->is_capturing()) return stream->capture(primitive_iface, args);
+
+    exec_ctx_t ctx(stream, std::move(args));
+    return execute_with_ctx(primitive_iface, stream, ctx);
+}
+
+status_t dnnl_primitive_args_create(primitive_args_t **primitive_args,
+        const primitive_iface_t *primitive_iface, int nargs,
+        const dnnl_exec_arg_t *c_args) {
+    if (utils::any_null(primitive_args, primitive_iface))
+        return invalid_arguments;
+    if (!IMPLICATION(nargs > 0, c_args != nullptr)) return invalid_arguments;
+
+    exec_args_t args;
+    CHECK(cvt_primitive_args(
+            primitive_iface->pd()->impl().get(), nargs, c_args, args));
+
+    return safe_ptr_assign(*primitive_args,
+            new primitive_args_t(primitive_iface, std::move(args)));
+}
+
+status_t dnnl_primitive_args_destroy(primitive_args_t *primitive_args) {
+    delete primitive_args;
+    return success;
+}
+
+status_t dnnl_primitive_execute_bound(const primitive_iface_t *primitive_iface,
+        stream_t *stream, const primitive_args_t *primitive_args) {
+    bool ok = true
+            && !utils::any_null(primitive_iface, stream, primitive_args)
+            && primitive_iface->engine() == stream->engine()
+            && primitive_args->primitive_iface() == primitive_iface;
+    if (!ok) return invalid_arguments;
+
+    if (stream->is_capturing())
+        return stream->capture(primitive_iface, primitive_args->args());
+
+    exec_ctx_t ctx(stream, primitive_args->args());
+    return execute_with_ctx(primitive_iface, stream, ctx);
+}
 
 status_t dnnl_primitive_get_primitive_desc(
         const primitive_iface_t *primitive_iface,
@@ -283,7 +329,8 @@ status_t dnnl_primitive::init() {
         auto *scratchpad_ptr = create_scratchpad(
                 pd_->engine(), scratchpad_size, use_global_scratchpad);
         if (scratchpad_ptr == nullptr) return out_of_memory;
-        if (scratchpad_ptr->get_memory_storage() == nullptr) {
+        // A scratchpad that fails to get its buffer reports zero size.
+        if (scratchpad_ptr->size() == 0) {
             delete scratchpad_ptr;
             return out_of_memory;
         }
@@ -308,12 +355,15 @@ const primitive_desc_iface_t *dnnl_primitive::pd() const {
 
 status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
     const memory_storage_t *mem_storage = nullptr;
+    const scratchpad_t *acquired_from = nullptr;
     if (primitive_->pd()->attr()->scratchpad_mode_ == scratchpad_mode::user) {
         memory_t *scratchpad_memory = ctx.output(DNNL_ARG_SCRATCHPAD);
         mem_storage = scratchpad_memory ? scratchpad_memory->memory_storage()
                                         : nullptr;
     } else if (scratchpad_) {
-        mem_storage = scratchpad_->get_memory_storage();
+        mem_storage = scratchpad_->acquire();
+        if (mem_storage == nullptr) return out_of_memory;
+        acquired_from = scratchpad_.get();
     }
 
     auto scratchpad_grantor
@@ -323,9 +373,21 @@ status_t dnnl_primitive::execute(exec_ctx_t &ctx) const {
 
     auto status = primitive_->execute(ctx);
     ctx.set_scratchpad_grantor(nullptr);
+    if (acquired_from) acquired_from->release(mem_storage);
     return status;
 }
 
+status_t dnnl_primitive::get_team_task(
+        exec_ctx_t &ctx, team_task_t &task) const {
+    // A team task outlives the call, so it cannot use the scratchpad grantor
+    // that is set up per execution.
+    if (primitive_->pd()->scratchpad_registry().size() != 0)
+        return unimplemented;
+
+    ctx.set_resource_mapper(&resource_mapper_);
+    return primitive_->get_team_task(ctx, task);
+}
+
 status_t dnnl_primitive::get_cache_blob_size(size_t *size) const {
     return primitive_->get_cache_blob_size(engine(), size);
 }
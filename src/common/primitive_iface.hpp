@@ -65,6 +65,8 @@ struct dnnl_primitive : public dnnl::impl::c_compatible {
     dnnl::impl::status_t get_cache_blob(
             dnnl::impl::cache_blob_t cache_blob) const;
     dnnl::impl::status_t execute(dnnl::impl::exec_ctx_t &ctx) const;
+    dnnl::impl::status_t get_team_task(dnnl::impl::exec_ctx_t &ctx,
+            dnnl::impl::team_task_t &task) const;
 
     void retain() { counter_++; }
 
@@ -86,6 +88,30 @@ private:
     DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive);
 };
 
+// dnnl_primitive_args is a user facing set of execution arguments that has an
+// alias primitive_args_t for internal use. The arguments are converted and
+// validated against the primitive once, at creation time, and then reused for
+// every execution.
+//
+// Note: the object holds neither the primitive nor the memory objects, so both
+// must outlive it.
+struct dnnl_primitive_args : public dnnl::impl::c_compatible {
+    dnnl_primitive_args(const primitive_iface_t *primitive_iface,
+            dnnl::impl::exec_args_t &&args)
+        : primitive_iface_(primitive_iface), args_(std::move(args)) {}
+
+    const primitive_iface_t *primitive_iface() const {
+        return primitive_iface_;
+    }
+    const dnnl::impl::exec_args_t &args() const { return args_; }
+
+private:
+    const primitive_iface_t *primitive_iface_;
+    dnnl::impl::exec_args_t args_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(dnnl_primitive_args);
+};
+
 #endif
 
 // vim: et ts=4 sw=4 cindent cino^=l0,\:0,N-s
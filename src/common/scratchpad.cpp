@@ -14,7 +14,11 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <iterator>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <vector>
 
 #include "engine.hpp"
 #include "utils.hpp"
@@ -137,11 +141,161 @@ thread_local memory_storage_t *global_scratchpad_t::mem_storage_ = nullptr;
 thread_local size_t global_scratchpad_t::size_ = 0;
 thread_local unsigned int global_scratchpad_t::reference_count_ = 0;
 
+/*
+  Process-wide arena of scratchpad buffers shared by all threads. A buffer is
+  taken from the arena for the duration of a single execution only, so the
+  memory held is bounded by the number of concurrent executions rather than
+  by the number of threads that have ever executed a primitive. Released
+  buffers are kept for reuse as long as their total size does not exceed the
+  capacity set with ONEDNN_SCRATCHPAD_ARENA_CAPACITY (in megabytes).
+*/
+struct scratchpad_arena_t {
+    scratchpad_arena_t(size_t capacity) : capacity_(capacity) {}
+
+    ~scratchpad_arena_t() {
+        for (auto &e : free_)
+            delete e.second;
+    }
+
+    static size_t get_capacity() {
+        static const size_t capacity = (size_t)nstl::max(
+                0, getenv_int_user("SCRATCHPAD_ARENA_CAPACITY", 0));
+        return capacity << 20;
+    }
+
+    static scratchpad_arena_t &get() {
+        static scratchpad_arena_t arena(get_capacity());
+        return arena;
+    }
+
+    size_t capacity() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return capacity_;
+    }
+
+    size_t cached_size() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cached_size_;
+    }
+
+    // Frees the largest cached buffers until the rest fit the new capacity.
+    size_t set_capacity(size_t capacity) {
+        std::vector<memory_storage_t *> to_free;
+        size_t old_capacity;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            old_capacity = capacity_;
+            capacity_ = capacity;
+            while (cached_size_ > capacity_) {
+                auto it = std::prev(free_.end());
+                cached_size_ -= it->first;
+                to_free.push_back(it->second);
+                free_.erase(it);
+            }
+        }
+        for (auto *mem_storage : to_free)
+            delete mem_storage;
+        return old_capacity;
+    }
+
+    const memory_storage_t *acquire(engine_t *engine, size_t size) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            // Take the smallest cached buffer that is large enough.
+            auto it = free_.lower_bound(size);
+            if (it != free_.end()) {
+                auto *mem_storage = it->second;
+                cached_size_ -= it->first;
+                sizes_[mem_storage] = it->first;
+                free_.erase(it);
+                return mem_storage;
+            }
+        }
+
+        auto *mem_storage = create_scratchpad_memory_storage(engine, size);
+        if (mem_storage == nullptr) return nullptr;
+        std::lock_guard<std::mutex> lock(mutex_);
+        sizes_[mem_storage] = size;
+        return mem_storage;
+    }
+
+    void release(const memory_storage_t *mem_storage) {
+        auto *storage = const_cast<memory_storage_t *>(mem_storage);
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = sizes_.find(storage);
+        assert(it != sizes_.end());
+        const size_t size = it->second;
+        sizes_.erase(it);
+
+        if (cached_size_ + size <= capacity_) {
+            free_.emplace(size, storage);
+            cached_size_ += size;
+            return;
+        }
+        lock.unlock();
+        delete storage;
+    }
+
+private:
+    size_t capacity_;
+    size_t cached_size_ = 0;
+    std::multimap<size_t, memory_storage_t *> free_;
+    std::map<memory_storage_t *, size_t> sizes_;
+    std::mutex mutex_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(scratchpad_arena_t);
+};
+
+/*
+  Implementation of the scratchpad_t interface that takes a buffer from the
+  scratchpad arena for each execution
+*/
+struct arena_scratchpad_t : public scratchpad_t {
+    arena_scratchpad_t(engine_t *engine, size_t size)
+        : engine_(engine), size_(size) {}
+
+    const memory_storage_t *get_memory_storage() const override {
+        return nullptr;
+    }
+
+    size_t size() const override { return size_; }
+
+    const memory_storage_t *acquire() const override {
+        return scratchpad_arena_t::get().acquire(engine_, size_);
+    }
+
+    void release(const memory_storage_t *mem_storage) const override {
+        if (mem_storage) scratchpad_arena_t::get().release(mem_storage);
+    }
+
+    // Buffers are released right after the execution returns, which is only
+    // valid for synchronous execution.
+    static bool is_supported(engine_t *engine) {
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        UNUSED(engine);
+        return false;
+#else
+        return engine->kind() == engine_kind::cpu
+                && is_native_runtime(engine->runtime_kind())
+                && scratchpad_arena_t::get().capacity() > 0;
+#endif
+    }
+
+private:
+    engine_t *engine_;
+    size_t size_;
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(arena_scratchpad_t);
+};
+
 /*
    Scratchpad creation routine
 */
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad) {
+    if (use_global_scratchpad && arena_scratchpad_t::is_supported(engine))
+        return new arena_scratchpad_t(engine, size);
+
 #ifndef DNNL_ENABLE_CONCURRENT_EXEC
     /*
      * TODO: global scratchpad should be able to handle memory
@@ -158,5 +312,13 @@ scratchpad_t *create_scratchpad(
 #endif
 }
 
+size_t set_scratchpad_arena_capacity(size_t capacity) {
+    return scratchpad_arena_t::get().set_capacity(capacity);
+}
+
+size_t get_scratchpad_arena_cached_size() {
+    return scratchpad_arena_t::get().cached_size();
+}
+
 } // namespace impl
 } // namespace dnnl
@@ -28,11 +28,25 @@ struct scratchpad_t {
     virtual ~scratchpad_t() {}
     virtual const memory_storage_t *get_memory_storage() const = 0;
     virtual size_t size() const = 0;
+
+    // Returns the buffer to be used by a single execution, which is to be
+    // given back with release() once the execution is over. Scratchpads that
+    // own a buffer return it as is.
+    virtual const memory_storage_t *acquire() const {
+        return get_memory_storage();
+    }
+    virtual void release(const memory_storage_t *mem_storage) const {
+        UNUSED(mem_storage);
+    }
 };
 
 scratchpad_t *create_scratchpad(
         engine_t *engine, size_t size, bool use_global_scratchpad);
 
+// Undocumented API for testing. The capacity and cached size are in bytes.
+size_t DNNL_API set_scratchpad_arena_capacity(size_t capacity);
+size_t DNNL_API get_scratchpad_arena_cached_size();
+
 } // namespace impl
 } // namespace dnnl
 #endif
@@ -42,6 +42,7 @@ status_t serialize_desc(
         CASE(layer_normalization)
         CASE(lrn)
         CASE(matmul)
+        CASE(optimizer)
         CASE(pooling)
         CASE(prelu)
         CASE(reduction)
@@ -50,6 +51,7 @@ status_t serialize_desc(
         CASE(rnn)
         CASE(shuffle)
         CASE(softmax)
+        CASE(softmax_cross_entropy)
         CASE(sum)
         default: return status::invalid_arguments;
     }
@@ -130,12 +132,116 @@ void serialize_md(serialization_stream_t &sstream, const memory_desc_t &md) {
     }
 }
 
+status_t deserialize_md(
+        deserialization_stream_t &dstream, memory_desc_t &md) {
+#define READ_OR_FAIL(...) \
+    do { \
+        if (!dstream.read(__VA_ARGS__)) return status::invalid_arguments; \
+    } while (0)
+
+    md = types::zero_md();
+    READ_OR_FAIL(&md.ndims);
+    if (md.ndims < 0 || md.ndims > DNNL_MAX_NDIMS)
+        return status::invalid_arguments;
+    READ_OR_FAIL(md.dims, md.ndims);
+    READ_OR_FAIL(&md.data_type);
+    READ_OR_FAIL(md.padded_dims, md.ndims);
+    READ_OR_FAIL(md.padded_offsets, md.ndims);
+    READ_OR_FAIL(&md.offset0);
+    READ_OR_FAIL(&md.format_kind);
+    // A zero descriptor is the only one without a format; anything else has
+    // to pass the same checks as a descriptor created through the API.
+    if (md.ndims == 0) {
+        if (md.format_kind != format_kind::undef)
+            return status::invalid_arguments;
+    } else if (!utils::one_of(md.format_kind, format_kind::any,
+                       format_kind::blocked, format_kind::wino,
+                       format_kind::rnn_packed)
+            || !memory_desc_sanity_check(
+                    md.ndims, md.dims, md.data_type, md.format_kind))
+        return status::invalid_arguments;
+    // format desc
+    switch ((int)md.format_kind) {
+        case format_kind::undef:
+        case format_kind::any: break;
+        case format_kind::blocked: {
+            auto &blk = md.format_desc.blocking;
+            READ_OR_FAIL(blk.strides, md.ndims);
+            READ_OR_FAIL(&blk.inner_nblks);
+            if (blk.inner_nblks < 0 || blk.inner_nblks > DNNL_MAX_NDIMS)
+                return status::invalid_arguments;
+            READ_OR_FAIL(blk.inner_blks, blk.inner_nblks);
+            READ_OR_FAIL(blk.inner_idxs, blk.inner_nblks);
+            for (int i = 0; i < blk.inner_nblks; i++)
+                if (blk.inner_blks[i] <= 0 || blk.inner_idxs[i] < 0
+                        || blk.inner_idxs[i] >= md.ndims)
+                    return status::invalid_arguments;
+            break;
+        }
+        case format_kind::wino: {
+            auto &wino = md.format_desc.wino_desc;
+            READ_OR_FAIL(&wino.wino_format);
+            READ_OR_FAIL(&wino.r);
+            READ_OR_FAIL(&wino.alpha);
+            READ_OR_FAIL(&wino.ic);
+            READ_OR_FAIL(&wino.oc);
+            READ_OR_FAIL(&wino.ic_block);
+            READ_OR_FAIL(&wino.oc_block);
+            READ_OR_FAIL(&wino.ic2_block);
+            READ_OR_FAIL(&wino.oc2_block);
+            READ_OR_FAIL(&wino.adj_scale);
+            READ_OR_FAIL(&wino.size);
+            break;
+        }
+        case format_kind::rnn_packed: {
+            auto &rnn = md.format_desc.rnn_packed_desc;
+            READ_OR_FAIL(&rnn.format);
+            READ_OR_FAIL(&rnn.n_parts);
+            READ_OR_FAIL(&rnn.n);
+            READ_OR_FAIL(&rnn.ldb);
+            if (rnn.n_parts < 0 || rnn.n_parts > rnn.max_n_parts)
+                return status::invalid_arguments;
+            READ_OR_FAIL(rnn.parts, rnn.n_parts);
+            READ_OR_FAIL(rnn.part_pack_size, rnn.n_parts);
+            READ_OR_FAIL(rnn.pack_part, rnn.n_parts);
+            READ_OR_FAIL(&rnn.offset_compensation);
+            READ_OR_FAIL(&rnn.size);
+            break;
+        }
+        default: return status::invalid_arguments;
+    }
+
+    // The extra section is written only when some flags are set.
+    if (!dstream.empty()) {
+        READ_OR_FAIL(&md.extra.flags);
+        if ((md.extra.flags
+                    & (dnnl_memory_extra_flag_compensation_conv_s8s8
+                            | dnnl_memory_extra_flag_rnn_u8s8_compensation))
+                && !types::extra_flag_rnn_s8s8_compensation_is_set(
+                        md.extra.flags)) {
+            READ_OR_FAIL(&md.extra.compensation_mask);
+        }
+
+        if (md.extra.flags & dnnl_memory_extra_flag_scale_adjust) {
+            READ_OR_FAIL(&md.extra.scale_adjust);
+        }
+
+        if (md.extra.flags
+                & dnnl_memory_extra_flag_compensation_conv_asymmetric_src) {
+            READ_OR_FAIL(&md.extra.asymm_compensation_mask);
+        }
+    }
+
+#undef READ_OR_FAIL
+    return dstream.empty() ? status::success : status::invalid_arguments;
+}
+
 void serialize_post_ops(
         serialization_stream_t &sstream, const post_ops_t &post_ops) {
     // post_ops: entry[:]
     for (int i = 0; i < post_ops.len(); i++) {
         const auto &entry = post_ops.entry_[i];
-        switch (entry.kind) {
+        switch ((int)entry.kind) {
             case primitive_kind::eltwise:
                 sstream.write(&entry.eltwise.alg);
                 sstream.write(&entry.eltwise.scale);
@@ -160,6 +266,11 @@ void serialize_post_ops(
                 serialize_md(sstream, entry.binary.user_src1_desc);
                 break;
             case primitive_kind::prelu: sstream.write(&entry.prelu.mask); break;
+            case primitive_kind::glu:
+                sstream.write(&entry.glu.alg);
+                sstream.write(&entry.glu.alpha);
+                sstream.write(&entry.glu.beta);
+                break;
             default: assert(!"unknown post_op");
         }
     }
@@ -171,6 +282,9 @@ void serialize_attr(
     sstream.write(&attr.scratchpad_mode_);
     // fpmath_mode
     sstream.write(&attr.fpmath_mode_);
+    sstream.write(&attr.fpmath_apply_to_int_);
+    // output_select
+    sstream.write(&attr.output_select_);
 
     if (!attr.output_scales_.has_default_values()) {
         // output_scales: mask
@@ -405,6 +519,23 @@ void serialize_desc(
     sstream.write(&desc.accum_data_type);
 }
 
+void serialize_desc(
+        serialization_stream_t &sstream, const optimizer_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    sstream.write(&desc.alg_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.weights_desc);
+    serialize_md(sstream, desc.diff_weights_desc);
+    // Hyperparameters
+    sstream.write(&desc.beta_1);
+    sstream.write(&desc.beta_2);
+    sstream.write(&desc.epsilon);
+    sstream.write(&desc.weight_decay);
+    // Flags
+    sstream.write(&desc.flags);
+}
+
 void serialize_desc(
         serialization_stream_t &sstream, const pooling_desc_t &desc) {
     // Kinds
@@ -547,6 +678,19 @@ void serialize_desc(
     sstream.write(&desc.softmax_axis);
 }
 
+void serialize_desc(serialization_stream_t &sstream,
+        const softmax_cross_entropy_desc_t &desc) {
+    // Kinds
+    sstream.write(&desc.primitive_kind);
+    // Memory descriptors
+    serialize_md(sstream, desc.src_desc);
+    serialize_md(sstream, desc.labels_desc);
+    serialize_md(sstream, desc.dst_desc);
+    serialize_md(sstream, desc.diff_src_desc);
+    // Label smoothing
+    sstream.write(&desc.label_smoothing);
+}
+
 void serialize_desc(serialization_stream_t &sstream, const sum_desc_t &desc) {
     // Kinds
     sstream.write(&desc.primitive_kind);
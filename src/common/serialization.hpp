@@ -32,6 +32,9 @@ void serialize_post_ops(
 void serialize_attr(
         serialization_stream_t &sstream, const primitive_attr_t &attr);
 void serialize_md(serialization_stream_t &sstream, const memory_desc_t &md);
+// Restores a memory descriptor written by serialize_md(). The stream is
+// expected to hold exactly one descriptor.
+status_t deserialize_md(deserialization_stream_t &dstream, memory_desc_t &md);
 void serialize_desc(serialization_stream_t &sstream, const concat_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream,
         const batch_normalization_desc_t &desc);
@@ -49,6 +52,8 @@ void serialize_desc(serialization_stream_t &sstream,
         const layer_normalization_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const lrn_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const matmul_desc_t &desc);
+void serialize_desc(
+        serialization_stream_t &sstream, const optimizer_desc_t &desc);
 void serialize_desc(
         serialization_stream_t &sstream, const pooling_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const prelu_desc_t &desc);
@@ -63,6 +68,8 @@ void serialize_desc(
         serialization_stream_t &sstream, const shuffle_desc_t &desc);
 void serialize_desc(
         serialization_stream_t &sstream, const softmax_desc_t &desc);
+void serialize_desc(serialization_stream_t &sstream,
+        const softmax_cross_entropy_desc_t &desc);
 void serialize_desc(serialization_stream_t &sstream, const sum_desc_t &desc);
 
 status_t serialize_desc(
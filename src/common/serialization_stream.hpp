@@ -18,6 +18,7 @@
 #define COMMON_SERIALIZATION_STREAM_HPP
 
 #include <cstdint>
+#include <cstring>
 #include <vector>
 #include <type_traits>
 
@@ -57,6 +58,44 @@ private:
     std::vector<uint8_t> data_;
 };
 
+// Reads back the data written by serialization_stream_t. A read that runs
+// past the end of the data fails and leaves the destination untouched.
+struct deserialization_stream_t {
+    deserialization_stream_t(const uint8_t *data, size_t size)
+        : data_(data), size_(size) {}
+
+    template <typename T>
+    bool read(T ptr, size_t nelems = 1) {
+        using non_pointer_type = typename std::remove_pointer<T>::type;
+
+        static_assert(std::is_pointer<T>::value,
+                "T is expected to be a pointer type.");
+        static_assert(!std::is_pointer<non_pointer_type>::value,
+                "T cannot be a pointer to pointer.");
+        static_assert(!std::is_class<non_pointer_type>::value,
+                "non-pointer type is expected to be a trivial type to avoid "
+                "padding issues.");
+        static_assert(!std::is_array<non_pointer_type>::value,
+                "non-pointer type cannot be an array.");
+
+        return read_impl((void *)ptr, sizeof(non_pointer_type) * nelems);
+    }
+
+    bool empty() const { return pos_ == size_; }
+
+private:
+    bool read_impl(void *ptr, size_t size) {
+        if (size > size_ - pos_) return false;
+        std::memcpy(ptr, data_ + pos_, size);
+        pos_ += size;
+        return true;
+    }
+
+    const uint8_t *data_;
+    size_t size_;
+    size_t pos_ = 0;
+};
+
 } // namespace impl
 } // namespace dnnl
 
@@ -0,0 +1,137 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "oneapi/dnnl/dnnl.h"
+#include "opdesc.hpp"
+#include "primitive_desc_iface.hpp"
+
+#include "c_types_map.hpp"
+#include "type_helpers.hpp"
+#include "utils.hpp"
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::status;
+using namespace dnnl::impl::utils;
+
+#define VCHECK_SOFTMAX_CE(cond, msg, ...) \
+    VCONDCHECK(create, check, softmax_cross_entropy, (cond), \
+            status::invalid_arguments, msg, ##__VA_ARGS__);
+
+#define VCHECK_SOFTMAX_CE_UNIMPL(cond, msg, ...) \
+    VCONDCHECK(create, check, softmax_cross_entropy, (cond), \
+            status::unimplemented, msg, ##__VA_ARGS__);
+
+namespace {
+status_t softmax_cross_entropy_desc_init(
+        softmax_cross_entropy_desc_t *sce_desc, const memory_desc_t *src_desc,
+        const memory_desc_t *labels_desc, const memory_desc_t *dst_desc,
+        const memory_desc_t *diff_src_desc, float label_smoothing) {
+    VCHECK_SOFTMAX_CE(!any_null(sce_desc, src_desc, labels_desc, dst_desc),
+            VERBOSE_NULL_ARG);
+    VCHECK_SOFTMAX_CE(0.f <= label_smoothing && label_smoothing < 1.f,
+            VERBOSE_BAD_PARAM, "label_smoothing");
+
+    if (diff_src_desc == nullptr) diff_src_desc = &glob_zero_md;
+    const bool with_diff_src = !memory_desc_wrapper(diff_src_desc).is_zero();
+
+    // The logits are N x C with the classes along the innermost logical
+    // dimension. The labels and the per-sample loss are N.
+    VCHECK_SOFTMAX_CE(src_desc->ndims == 2, VERBOSE_BAD_NDIMS, "src",
+            src_desc->ndims);
+    VCHECK_SOFTMAX_CE(labels_desc->ndims == 1, VERBOSE_BAD_NDIMS, "labels",
+            labels_desc->ndims);
+    VCHECK_SOFTMAX_CE(
+            dst_desc->ndims == 1, VERBOSE_BAD_NDIMS, "dst", dst_desc->ndims);
+    VCHECK_SOFTMAX_CE(labels_desc->dims[0] == src_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "labels", 0, "src", 0);
+    VCHECK_SOFTMAX_CE(dst_desc->dims[0] == src_desc->dims[0],
+            VERBOSE_INCONSISTENT_DIM, "dst", 0, "src", 0);
+    if (with_diff_src) {
+        VCHECK_SOFTMAX_CE(diff_src_desc->ndims == 2,
+                VERBOSE_INCONSISTENT_NDIMS, "diff_src", "src");
+        VCHECK_SOFTMAX_CE(
+                array_cmp(diff_src_desc->dims, src_desc->dims, 2),
+                VERBOSE_INCONSISTENT_DIM, "diff_src", -1, "src", -1);
+    }
+    VCHECK_SOFTMAX_CE(labels_desc->data_type == data_type::s32,
+            VERBOSE_INVALID_DATATYPE, "labels");
+
+    VCHECK_SOFTMAX_CE_UNIMPL(
+            !memory_desc_wrapper(src_desc).has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(labels_desc)
+                                .has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(dst_desc)
+                                .has_runtime_dims_or_strides()
+                    && !memory_desc_wrapper(diff_src_desc)
+                                .has_runtime_dims_or_strides(),
+            VERBOSE_RUNTIMEDIM_UNSUPPORTED);
+    VCHECK_SOFTMAX_CE(
+            src_desc->extra.flags == 0, VERBOSE_UNSUPPORTED_MD_FLAG, "src");
+    VCHECK_SOFTMAX_CE(diff_src_desc->extra.flags == 0,
+            VERBOSE_UNSUPPORTED_MD_FLAG, "diff_src");
+
+    auto sd = softmax_cross_entropy_desc_t();
+    sd.primitive_kind = primitive_kind::softmax_cross_entropy;
+
+    sd.src_desc = *src_desc;
+    sd.labels_desc = *labels_desc;
+    sd.dst_desc = *dst_desc;
+    sd.diff_src_desc = *diff_src_desc;
+    sd.label_smoothing = label_smoothing;
+
+    *sce_desc = sd;
+    return success;
+}
+
+status_t softmax_cross_entropy_attr_check(
+        const softmax_cross_entropy_desc_t &desc, const engine_t *engine,
+        const primitive_attr_t *attr) {
+    using smask_t = primitive_attr_t::skip_mask_t;
+
+    if (attr == nullptr) return status::success;
+    if (attr->has_default_values()) return status::success;
+
+    // Only a common scale of the gradient is supported. It is meant for
+    // averaging over the batch and for scaling the loss in mixed precision
+    // training.
+    VCHECK_SOFTMAX_CE_UNIMPL(
+            attr->has_default_values(smask_t::scales_runtime),
+            VERBOSE_UNSUPPORTED_ATTR);
+    const auto &sc = attr->scales_;
+    VCHECK_SOFTMAX_CE_UNIMPL(sc.has_default_values({DNNL_ARG_DIFF_SRC})
+                    && sc.get(DNNL_ARG_DIFF_SRC).mask_ == 0,
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+    VCHECK_SOFTMAX_CE_UNIMPL(
+            !memory_desc_wrapper(desc.diff_src_desc).is_zero(),
+            VERBOSE_UNSUPPORTED_SCALES_CFG);
+
+    return status::success;
+}
+
+} // namespace
+
+dnnl_status_t dnnl_softmax_cross_entropy_primitive_desc_create(
+        primitive_desc_iface_t **primitive_desc_iface, engine_t *engine,
+        const memory_desc_t *src_desc, const memory_desc_t *labels_desc,
+        const memory_desc_t *dst_desc, const memory_desc_t *diff_src_desc,
+        float label_smoothing, const primitive_attr_t *attr) {
+    auto sce_desc = softmax_cross_entropy_desc_t();
+    CHECK(softmax_cross_entropy_desc_init(&sce_desc, src_desc, labels_desc,
+            dst_desc, diff_src_desc, label_smoothing));
+    CHECK(softmax_cross_entropy_attr_check(sce_desc, engine, attr));
+    return primitive_desc_create(primitive_desc_iface, engine,
+            (const op_desc_t *)&sce_desc, nullptr, attr);
+}
@@ -0,0 +1,126 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef COMMON_SOFTMAX_CROSS_ENTROPY_PD_HPP
+#define COMMON_SOFTMAX_CROSS_ENTROPY_PD_HPP
+
+#include "oneapi/dnnl/dnnl.h"
+
+#include "c_types_map.hpp"
+#include "primitive_desc.hpp"
+#include "utils.hpp"
+
+#define VDISPATCH_SOFTMAX_CE(cond, msg, ...) \
+    VCONDCHECK(create, dispatch, softmax_cross_entropy, (cond), \
+            status::unimplemented, "%s," msg, this->info(engine), \
+            ##__VA_ARGS__)
+
+namespace dnnl {
+namespace impl {
+
+struct softmax_cross_entropy_pd_t : public primitive_desc_t {
+    static constexpr auto base_pkind = primitive_kind::softmax_cross_entropy;
+
+    typedef softmax_cross_entropy_pd_t hint_class;
+
+    const softmax_cross_entropy_desc_t *desc() const { return &desc_; }
+    const op_desc_t *op_desc() const override {
+        return reinterpret_cast<const op_desc_t *>(this->desc());
+    }
+
+    arg_usage_t arg_usage(int arg) const override {
+        if (utils::one_of(arg, DNNL_ARG_SRC, DNNL_ARG_LABELS))
+            return arg_usage_t::input;
+        if (arg == DNNL_ARG_DST) return arg_usage_t::output;
+        if (arg == DNNL_ARG_DIFF_SRC && with_diff_src())
+            return arg_usage_t::output;
+        return primitive_desc_t::arg_usage(arg);
+    }
+
+    const memory_desc_t *arg_md(
+            int arg, bool user_input = false) const override {
+        switch (arg) {
+            case DNNL_ARG_SRC: return src_md(0, user_input);
+            case DNNL_ARG_LABELS:
+                return user_input ? &desc()->labels_desc : &labels_md_;
+            case DNNL_ARG_DST: return dst_md(0, user_input);
+            case DNNL_ARG_DIFF_SRC: return diff_src_md(0, user_input);
+            default: return primitive_desc_t::arg_md(arg);
+        }
+    }
+
+    const memory_desc_t *src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->src_desc : &src_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *dst_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0) return user_input ? &desc()->dst_desc : &dst_md_;
+        return &glob_zero_md;
+    }
+    const memory_desc_t *diff_src_md(
+            int index = 0, bool user_input = false) const override {
+        if (index == 0)
+            return user_input ? &desc()->diff_src_desc : &diff_src_md_;
+        return &glob_zero_md;
+    }
+
+    int n_inputs() const override { return 2; }
+    int n_outputs() const override { return 1 + with_diff_src(); }
+
+    dim_t batch() const { return src_md_.dims[0]; }
+    dim_t classes() const { return src_md_.dims[1]; }
+
+    bool with_diff_src() const {
+        return !memory_desc_wrapper(desc_.diff_src_desc).is_zero();
+    }
+
+protected:
+    softmax_cross_entropy_desc_t desc_;
+
+    memory_desc_t src_md_;
+    memory_desc_t labels_md_;
+    memory_desc_t dst_md_;
+    memory_desc_t diff_src_md_;
+
+    softmax_cross_entropy_pd_t(const softmax_cross_entropy_desc_t *adesc,
+            const primitive_attr_t *attr, const hint_class *hint_fwd)
+        : primitive_desc_t(attr, base_pkind)
+        , desc_(*adesc)
+        , src_md_(desc_.src_desc)
+        , labels_md_(desc_.labels_desc)
+        , dst_md_(desc_.dst_desc)
+        , diff_src_md_(desc_.diff_src_desc) {}
+
+    status_t set_default_params() {
+        if (src_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(src_md_, nullptr));
+        if (labels_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(labels_md_, format_tag::a));
+        if (dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_tag(dst_md_, format_tag::a));
+        if (with_diff_src() && diff_src_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_blocking_desc(
+                    diff_src_md_, src_md_.format_desc.blocking));
+        return status::success;
+    }
+};
+
+} // namespace impl
+} // namespace dnnl
+
+#endif
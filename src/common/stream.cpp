@@ -19,6 +19,7 @@
 
 #include "c_types_map.hpp"
 #include "engine.hpp"
+#include "exec_plan.hpp"
 #include "primitive_exec_types.hpp"
 #include "primitive_iface.hpp"
 #include "stream.hpp"
@@ -33,6 +34,30 @@ status_t stream_t::enqueue_primitive(
     return primitive_iface->execute(ctx);
 }
 
+dnnl_stream::~dnnl_stream() {
+    delete capture_;
+}
+
+status_t stream_t::begin_capture() {
+    if (is_capturing()) return invalid_arguments;
+    capture_ = new exec_plan_t(engine());
+    return success;
+}
+
+status_t stream_t::end_capture(exec_plan_t **exec_plan) {
+    if (!is_capturing()) return invalid_arguments;
+    *exec_plan = capture_;
+    capture_ = nullptr;
+    return success;
+}
+
+status_t stream_t::capture(
+        const primitive_iface_t *primitive_iface, const exec_args_t &args) {
+    assert(is_capturing());
+    capture_->append(primitive_iface, args);
+    return success;
+}
+
 /* API */
 
 status_t dnnl_stream_create(
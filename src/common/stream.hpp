@@ -25,10 +25,16 @@
 #include "engine.hpp"
 #include "utils.hpp"
 
+namespace dnnl {
+namespace impl {
+struct exec_args_t;
+} // namespace impl
+} // namespace dnnl
+
 struct dnnl_stream : public dnnl::impl::c_compatible {
     dnnl_stream(dnnl::impl::engine_t *engine, unsigned flags)
         : engine_(engine), flags_(flags) {}
-    virtual ~dnnl_stream() {}
+    virtual ~dnnl_stream();
 
     /** returns stream's engine */
     dnnl::impl::engine_t *engine() const { return engine_; }
@@ -71,6 +77,14 @@ struct dnnl_stream : public dnnl::impl::c_compatible {
     virtual dnnl::impl::status_t zero_pad(const dnnl::impl::memory_t *memory,
             const dnnl::impl::exec_ctx_t &ctx);
 
+    // While a stream is capturing, primitive executions submitted to it are
+    // recorded into an execution plan instead of being run.
+    dnnl::impl::status_t begin_capture();
+    dnnl::impl::status_t end_capture(exec_plan_t **exec_plan);
+    bool is_capturing() const { return capture_ != nullptr; }
+    dnnl::impl::status_t capture(const primitive_iface_t *primitive_iface,
+            const dnnl::impl::exec_args_t &args);
+
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl_stream(dnnl::impl::engine_t *engine,
             dnnl::threadpool_interop::threadpool_iface *threadpool)
@@ -95,6 +109,9 @@ protected:
 #if DNNL_CPU_RUNTIME == DNNL_RUNTIME_THREADPOOL
     dnnl::threadpool_interop::threadpool_iface *threadpool_ = nullptr;
 #endif
+
+private:
+    exec_plan_t *capture_ = nullptr;
 };
 
 #endif
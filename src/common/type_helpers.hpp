@@ -583,6 +583,20 @@ inline bool operator==(const matmul_desc_t &lhs, const matmul_desc_t &rhs) {
     return ret;
 }
 
+inline bool operator==(
+        const optimizer_desc_t &lhs, const optimizer_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(alg_kind)
+            && COMPARE_DESC_MEMBERS(weights_desc)
+            && COMPARE_DESC_MEMBERS(diff_weights_desc)
+            && COMPARE_FLOAT_DESC_MEMBERS(beta_1)
+            && COMPARE_FLOAT_DESC_MEMBERS(beta_2)
+            && COMPARE_FLOAT_DESC_MEMBERS(epsilon)
+            && COMPARE_FLOAT_DESC_MEMBERS(weight_decay)
+            && COMPARE_DESC_MEMBERS(flags);
+    return ret;
+}
+
 inline bool operator==(
         const pooling_desc_t &lhs, const pooling_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
@@ -703,6 +717,17 @@ inline bool operator==(
      return ret;
 }
 
+inline bool operator==(const softmax_cross_entropy_desc_t &lhs,
+        const softmax_cross_entropy_desc_t &rhs) {
+    bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
+            && COMPARE_DESC_MEMBERS(src_desc)
+            && COMPARE_DESC_MEMBERS(labels_desc)
+            && COMPARE_DESC_MEMBERS(dst_desc)
+            && COMPARE_DESC_MEMBERS(diff_src_desc)
+            && COMPARE_FLOAT_DESC_MEMBERS(label_smoothing);
+    return ret;
+}
+
 inline bool operator==(const sum_desc_t &lhs, const sum_desc_t &rhs) {
     bool ret = COMPARE_DESC_MEMBERS(primitive_kind)
             && DEREF_AND_COMPARE_DESC_MEMBERS(dst_md)
@@ -1004,6 +1029,7 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(layer_normalization);
         CASE_OP_DESC(lrn);
         CASE_OP_DESC(matmul);
+        CASE_OP_DESC(optimizer);
         CASE_OP_DESC(pooling);
         CASE_OP_DESC(prelu);
         CASE_OP_DESC(reduction);
@@ -1011,6 +1037,7 @@ inline void copy_c_op_desc(op_desc_t *dst, const op_desc_t *src) {
         CASE_OP_DESC(rnn);
         CASE_OP_DESC(shuffle);
         CASE_OP_DESC(softmax);
+        CASE_OP_DESC(softmax_cross_entropy);
 
         // Internal descs
         CASE_OP_DESC(zero_pad);
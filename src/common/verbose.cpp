@@ -46,6 +46,7 @@
 #include "layer_normalization_pd.hpp"
 #include "lrn_pd.hpp"
 #include "matmul_pd.hpp"
+#include "optimizer_pd.hpp"
 #include "pooling_pd.hpp"
 #include "prelu_pd.hpp"
 #include "reduction_pd.hpp"
@@ -53,6 +54,7 @@
 #include "resampling_pd.hpp"
 #include "rnn_pd.hpp"
 #include "shuffle_pd.hpp"
+#include "softmax_cross_entropy_pd.hpp"
 #include "softmax_pd.hpp"
 #include "sum_pd.hpp"
 
@@ -259,6 +261,13 @@ std::string normalization_flags2str(unsigned flags) {
     return s;
 }
 
+std::string optimizer_flags2str(unsigned flags) {
+    std::string s;
+    if (flags & optimizer_flags::use_master_weights) s += "M";
+    if (flags & optimizer_flags::compute_diff_weights_norm) s += "N";
+    return s;
+}
+
 std::string rnn_flags2str(unsigned flags) {
     std::string s;
     if (flags & rnn_flags::diff_weights_overwrite) s += "O";
@@ -492,6 +501,8 @@ std::string get_arg(int arg) {
         case DNNL_ARG_SRC_1: s = "src"; break;
         case DNNL_ARG_DST: s = "dst"; break;
         case DNNL_ARG_WEIGHTS: s = "wei"; break;
+        case DNNL_ARG_DIFF_SRC: s = "diff_src"; break;
+        case DNNL_ARG_DIFF_WEIGHTS: s = "diff_wei"; break;
         case DNNL_ARG_ATTR_POST_OP_DW | DNNL_ARG_DST:
             s = "attr_post_op_dw_dst";
             break;
@@ -519,12 +530,17 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << "attr-scratchpad:" << dnnl_scratchpad_mode2str(spm) << " ";
     }
     const fpmath_mode_t &fpm = attr->fpmath_mode_;
-    if (fpm != fpmath_mode_t::dnnl_fpmath_mode_strict) {
-        ss << "attr-fpmath:" << dnnl_fpmath_mode2str(fpm) << " ";
+    if (fpm != fpmath_mode_t::dnnl_fpmath_mode_strict
+            || attr->fpmath_apply_to_int_) {
+        ss << "attr-fpmath:" << dnnl_fpmath_mode2str(fpm);
+        if (attr->fpmath_apply_to_int_) ss << ":true";
+        ss << " ";
     }
 
     if (attr->has_default_values()) return ss;
 
+    if (attr->output_select_) ss << "attr-output-select:1 ";
+
     const runtime_scales_t &os = attr->output_scales_;
     if (!os.has_default_values()) { ss << "attr-oscale:" << os << " "; }
 
@@ -567,7 +583,7 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
         ss << "attr-post-ops:";
         for (int i = 0; i < po.len(); ++i) {
             const post_ops_t::entry_t &e = po.entry_[i];
-            switch (e.kind) {
+            switch ((int)e.kind) {
                 case primitive_kind::sum: {
                     const auto &s = e.sum;
                     ss << delim << "sum";
@@ -616,6 +632,13 @@ std::ostream &operator<<(std::ostream &ss, const primitive_attr_t *attr) {
                     ss << delim << "prelu"
                        << ":" << ep.mask;
                 } break;
+                case primitive_kind::glu: {
+                    const post_ops_t::entry_t::eltwise_t &eg = e.glu;
+                    ss << delim << "glu:" << eg.alg;
+                    if (eg.alpha != 0.f || eg.beta != 0.f)
+                        ss << ":" << eg.alpha;
+                    if (eg.beta != 0.f) ss << ":" << eg.beta;
+                } break;
                 default: assert(!"unsupported post op primitive kind!"); break;
             }
             delim = attr_delim;
@@ -1063,6 +1086,28 @@ std::string init_info_reduction(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_optimizer(const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto wei_md = pd->weights_md();
+    ss << "wei_" << wei_md;
+    ss << " diff_wei_" << pd->diff_weights_md();
+    ss << ",";
+
+    const auto desc = pd->desc();
+    ss << pd->attr() << ",";
+    ss << "alg:" << desc->alg_kind << " beta_1:" << desc->beta_1
+       << " beta_2:" << desc->beta_2 << " eps:" << desc->epsilon
+       << " wd:" << desc->weight_decay
+       << " flags:" << optimizer_flags2str(desc->flags) << ",";
+    ss << md2dim_str(wei_md);
+
+    return ss.str();
+}
+
 std::string mds2str_reorder(const memory_desc_t *src_md,
         format_kind_t src_user_format_kind, const memory_desc_t *dst_md,
         format_kind_t dst_user_format_kind) {
@@ -1225,6 +1270,26 @@ std::string init_info_softmax(const engine_t *e, const pd_t *pd) {
     return ss.str();
 }
 
+template <typename pd_t>
+std::string init_info_softmax_cross_entropy(
+        const engine_t *e, const pd_t *pd) {
+    std::stringstream ss;
+    ss << e << "," << pd->kind() << "," << pd->name() << "," << prop_kind::undef
+       << ",";
+
+    auto src_md = pd->src_md();
+    ss << "src_" << src_md;
+    ss << " labels_" << pd->arg_md(DNNL_ARG_LABELS);
+    ss << " dst_" << pd->dst_md();
+    if (pd->with_diff_src()) ss << " diff_src_" << pd->diff_src_md();
+
+    ss << "," << pd->attr() << ",";
+    ss << "label_smoothing:" << pd->desc()->label_smoothing << ",";
+    ss << md2dim_str(src_md);
+
+    return ss.str();
+}
+
 template <typename pd_t>
 std::string init_info_sum(const engine_t *e, const pd_t *pd) {
     std::stringstream ss;
@@ -1274,6 +1339,7 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::inner_product:
         case primitive_kind::layer_normalization:
         case primitive_kind::lrn:
+        case primitive_kind::optimizer:
         case primitive_kind::pooling:
         case primitive_kind::prelu:
         case primitive_kind::reduction:
@@ -1281,6 +1347,7 @@ std::string rt_mds2str(primitive_kind_t prim_kind, const memory_desc_t *src_md,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
+        case primitive_kind::softmax_cross_entropy:
         case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
         default: assert(!"unknown primitive kind");
     }
@@ -1306,6 +1373,7 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::inner_product:
         case primitive_kind::layer_normalization:
         case primitive_kind::lrn:
+        case primitive_kind::optimizer:
         case primitive_kind::pooling:
         case primitive_kind::prelu:
         case primitive_kind::reduction:
@@ -1313,6 +1381,7 @@ std::string rt_dims2fmt_str(primitive_kind_t prim_kind,
         case primitive_kind::rnn:
         case primitive_kind::shuffle:
         case primitive_kind::softmax:
+        case primitive_kind::softmax_cross_entropy:
         case primitive_kind::sum: assert(!"unsupported primitive kind"); break;
         default: assert(!"unknown primitive kind");
     }
@@ -1342,6 +1411,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(layer_normalization);
             CASE(lrn);
             CASE(matmul);
+            CASE(optimizer);
             CASE(pooling);
             CASE(prelu);
             CASE(reduction);
@@ -1350,6 +1420,7 @@ void pd_info_t::init(engine_t *engine, const primitive_desc_t *pd) {
             CASE(rnn);
             CASE(shuffle);
             CASE(softmax);
+            CASE(softmax_cross_entropy);
             CASE(sum);
             case primitive_kind::zero_pad:
               str_ = "zero_pad, unknown info";
@@ -63,6 +63,7 @@ DECLARE_IMPL_LIST(inner_product);
 DECLARE_IMPL_LIST(layer_normalization);
 DECLARE_IMPL_LIST(lrn);
 DECLARE_IMPL_LIST(matmul);
+DECLARE_IMPL_LIST(optimizer);
 DECLARE_IMPL_LIST(pooling);
 DECLARE_IMPL_LIST(prelu);
 DECLARE_IMPL_LIST(reduction);
@@ -70,6 +71,7 @@ DECLARE_IMPL_LIST(resampling);
 DECLARE_IMPL_LIST(rnn);
 DECLARE_IMPL_LIST(shuffle);
 DECLARE_IMPL_LIST(softmax);
+DECLARE_IMPL_LIST(softmax_cross_entropy);
 
 #undef DECLARE_IMPL_LIST
 
@@ -99,6 +101,7 @@ public:
             CASE(layer_normalization);
             CASE(lrn);
             CASE(matmul);
+            CASE(optimizer);
             CASE(pooling);
             CASE(prelu);
             CASE(reduction);
@@ -106,6 +109,7 @@ public:
             CASE(rnn);
             CASE(shuffle);
             CASE(softmax);
+            CASE(softmax_cross_entropy);
             default: assert(!"unknown primitive kind"); return empty_list;
         }
 #undef CASE
@@ -19,6 +19,12 @@
 
 #include <memory>
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "common/c_types_map.hpp"
 #include "common/memory.hpp"
 #include "common/memory_storage.hpp"
@@ -101,6 +107,114 @@ private:
     static void destroy(void *ptr) { free(ptr); }
 };
 
+// Read-only storage backed by a private mapping of a file. Pages are read in
+// lazily on the first access, and the mapping is released together with the
+// storage unless another data handle has been set.
+class cpu_file_memory_storage_t : public memory_storage_t {
+public:
+    cpu_file_memory_storage_t(engine_t *engine) : memory_storage_t(engine) {}
+
+    ~cpu_file_memory_storage_t() override { unmap(); }
+
+    status_t map_file(int fd, size_t offset, size_t size) {
+#ifdef _WIN32
+        UNUSED(fd);
+        UNUSED(offset);
+        UNUSED(size);
+        return status::unimplemented;
+#else
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0) return status::invalid_arguments;
+        if (size == 0 || offset + size < offset
+                || offset + size > (size_t)st.st_size)
+            return status::invalid_arguments;
+
+        const size_t page_size = (size_t)sysconf(_SC_PAGESIZE);
+        const size_t page_offset = offset % page_size;
+        const size_t mapped_size = size + page_offset;
+        void *base = mmap(nullptr, mapped_size, PROT_READ, MAP_PRIVATE, fd,
+                (off_t)(offset - page_offset));
+        if (base == MAP_FAILED) return status::out_of_memory;
+        // Weights are mostly streamed through in order, so ask for an
+        // aggressive read-ahead on page faults instead of reading the whole
+        // range in upfront.
+        posix_madvise(base, mapped_size, POSIX_MADV_SEQUENTIAL);
+
+        unmap();
+        base_ = base;
+        mapped_size_ = mapped_size;
+        data_ = reinterpret_cast<uint8_t *>(base) + page_offset;
+        return status::success;
+#endif
+    }
+
+    status_t get_data_handle(void **handle) const override {
+        *handle = data_;
+        return status::success;
+    }
+
+    status_t set_data_handle(void *handle) override {
+        if (handle == data_) return status::success;
+        unmap();
+        data_ = handle;
+        return status::success;
+    }
+
+    status_t map_data(
+            void **mapped_ptr, stream_t *stream, size_t size) const override {
+        UNUSED(size);
+        if (stream != nullptr && stream->engine()->index() != engine()->index())
+            return status::invalid_arguments;
+        return get_data_handle(mapped_ptr);
+    }
+
+    status_t unmap_data(void *mapped_ptr, stream_t *stream) const override {
+        UNUSED(mapped_ptr);
+        if (stream != nullptr && stream->engine()->index() != engine()->index())
+            return status::invalid_arguments;
+        return status::success;
+    }
+
+    bool is_host_accessible() const override { return true; }
+
+    bool is_read_only() const override { return base_ != nullptr; }
+
+    std::unique_ptr<memory_storage_t> get_sub_storage(
+            size_t offset, size_t size) const override {
+        void *sub_ptr = reinterpret_cast<uint8_t *>(data_) + offset;
+        auto sub_storage = new cpu_memory_storage_t(this->engine());
+        sub_storage->init(memory_flags_t::use_runtime_ptr, size, sub_ptr);
+        return std::unique_ptr<memory_storage_t>(sub_storage);
+    }
+
+    std::unique_ptr<memory_storage_t> clone() const override {
+        auto storage = new cpu_memory_storage_t(engine());
+        if (storage) storage->init(memory_flags_t::use_runtime_ptr, 0, data_);
+        return std::unique_ptr<memory_storage_t>(storage);
+    }
+
+protected:
+    status_t init_allocate(size_t size) override {
+        UNUSED(size);
+        return status::unimplemented;
+    }
+
+private:
+    void *base_ = nullptr;
+    size_t mapped_size_ = 0;
+    void *data_ = nullptr;
+
+    void unmap() {
+#ifndef _WIN32
+        if (base_) munmap(base_, mapped_size_);
+#endif
+        base_ = nullptr;
+        mapped_size_ = 0;
+    }
+
+    DNNL_DISALLOW_COPY_AND_ASSIGN(cpu_file_memory_storage_t);
+};
+
 } // namespace cpu
 } // namespace impl
 } // namespace dnnl
@@ -39,12 +39,16 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const auto src = CTX_IN_MEM(const void *, DNNL_ARG_SRC);
     const auto weights = CTX_IN_MEM(const void *, DNNL_ARG_WEIGHTS);
     const auto bias = CTX_IN_MEM(const void *, DNNL_ARG_BIAS);
+    const auto output_select
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_OUTPUT_SELECT);
     auto dst = CTX_OUT_CLEAN_MEM(void *, DNNL_ARG_DST, status);
     CHECK(status);
 
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
     DEFINE_ARG_SCALES_BUFFER(dst_scales, DNNL_ARG_DST);
+    const auto wei_zero_points = CTX_IN_MEM(
+            const int32_t *, DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS);
 
     const auto src_d = ctx.memory_mdw(DNNL_ARG_SRC, pd()->src_md());
     const auto weights_d = ctx.memory_mdw(DNNL_ARG_WEIGHTS, pd()->weights_md());
@@ -72,15 +76,40 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
     const int bia_mask
             = utils::get_dims_mask(dst_d.dims(), bia_d.dims(), ndims);
 
-    // mm kernel
-    auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t n) {
+    if (pd()->with_output_select()) {
+        if (output_select == nullptr) return status::invalid_arguments;
+        const dim_t wei_N = weights_d.dims()[ndims - 1];
+        for (dim_t n = 0; n < N; ++n)
+            if (output_select[n] < 0 || output_select[n] >= wei_N)
+                return status::invalid_arguments;
+    }
+
+    // With output selection dst column `n` is computed from the weights
+    // column `output_select[n]`.
+    auto wei_n = [&](dim_t n) -> dim_t {
+        return output_select ? output_select[n] : n;
+    };
+
+    // weights zero points section, used by integer weights decompression
+    const auto &attr_zps = pd()->attr()->zero_points_;
+    const bool with_wei_zero_points
+            = !attr_zps.has_default_values(DNNL_ARG_WEIGHTS);
+    const dim_t wei_zp_stride = attr_zps.get(DNNL_ARG_WEIGHTS) == 0 ? 0 : 1;
+    if (with_wei_zero_points && wei_zero_points == nullptr)
+        return status::invalid_arguments;
+
+    // mm kernel, `wei_col` is the weights column contributing to dst
+    auto ker = [&](const dims_t dst_dims_idx, dim_t m, dim_t wei_col) {
+        const float wei_zp = with_wei_zero_points
+                ? (float)wei_zero_points[wei_zp_stride * wei_col]
+                : 0.f;
         float acc = 0;
         dims_t src_dims_idx, weights_dims_idx;
         utils::copy_dims_with_mask(src_dims_idx, dst_dims_idx, ndims, src_mask);
         utils::copy_dims_with_mask(
                 weights_dims_idx, dst_dims_idx, ndims, wei_mask);
         src_dims_idx[ndims - 2] = m;
-        weights_dims_idx[ndims - 1] = n;
+        weights_dims_idx[ndims - 1] = wei_col;
         auto &src_k_dim = src_dims_idx[ndims - 1];
         auto &wei_k_dim = weights_dims_idx[ndims - 2];
         for (dim_t k = 0; k < K; ++k) {
@@ -92,7 +121,7 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
                     = io::load_float_value(src_d.data_type(), src, src_off);
             const float w = io::load_float_value(
                     weights_d.data_type(), weights, weights_off);
-            acc += s * w;
+            acc += s * (w - wei_zp);
         }
         return acc;
     };
@@ -124,9 +153,15 @@ status_t ref_matmul_t::execute_ref(const exec_ctx_t &ctx) const {
         // account for M, N dims for index calculations
         const size_t l_offset = mb * M * N + m * N + n;
         utils::l_dims_by_l_offset(dst_dims_idx, l_offset, dst_d.dims(), ndims);
-        float d = ker(dst_dims_idx, m, n);
-        if (with_src_scales) d *= src_scales[0];
-        if (with_wei_scales) d *= wei_scales[wei_scale_stride * n];
+        auto scaled_ker = [&](dim_t wei_col) {
+            float acc = ker(dst_dims_idx, m, wei_col);
+            if (with_src_scales) acc *= src_scales[0];
+            if (with_wei_scales) acc *= wei_scales[wei_scale_stride * wei_col];
+            return acc;
+        };
+        float d = scaled_ker(wei_n(n));
+        // GLU: the gate half is activated and multiplied by the up half.
+        if (glu_eltwise) d = glu_eltwise->compute_scalar(d) * scaled_ker(n + N);
         if (bias) d += ker_bias(dst_dims_idx);
 
         const auto dst_off = dst_d.off_v(dst_dims_idx);
@@ -48,11 +48,13 @@ struct ref_matmul_t : public primitive_t {
             const auto wei_type = weights_md(0)->data_type;
             const auto bia_type = weights_md(1)->data_type;
             const auto dst_type = dst_md(0)->data_type;
+            const bool is_wei_decomp = attr()->fpmath_apply_to_int_
+                    && utils::one_of(wei_type, s8, u8);
 
             bool ok = is_dense_data() && utils::one_of(src_type, f32, bf16, f16)
-                    && utils::one_of(wei_type, f32, bf16, f16)
+                    && utils::one_of(wei_type, f32, bf16, f16, s8, u8)
                     && utils::one_of(dst_type, f32, bf16, f16)
-                    && src_type == wei_type
+                    && (src_type == wei_type || is_wei_decomp)
                     && IMPLICATION(src_type == f32, dst_type == f32)
                     && IMPLICATION(src_type == bf16,
                             utils::one_of(dst_type, f32, bf16))
@@ -68,11 +70,18 @@ struct ref_matmul_t : public primitive_t {
                                             utils::one_of(bia_type, f32, bf16)))
                     && platform::has_data_type_support(src_type)
                     && attr()->has_default_values(smask_t::scales_runtime
-                                    | smask_t::post_ops | smask_t::sum_dt,
+                                    | smask_t::zero_points_runtime
+                                    | smask_t::post_ops | smask_t::sum_dt
+                                    | smask_t::output_select,
                             dst_type)
+                    && IMPLICATION(!is_wei_decomp,
+                            attr()->zero_points_.has_default_values())
                     && attr_.post_ops_.check_sum_consistency(dst_type,
                             /* is_int8 */ false)
-                    && ref_post_ops_t::primitive_kind_ok(attr()->post_ops_)
+                    && attr()->post_ops_.has_default_values(
+                            {primitive_kind::binary, primitive_kind::eltwise,
+                                    primitive_kind::prelu, primitive_kind::sum,
+                                    primitive_kind::glu})
                     && attr_scales_ok() && set_default_formats()
                     && attr_.set_default_formats(dst_md(0)) == status::success;
             return ok ? status::success : status::unimplemented;
@@ -85,6 +94,12 @@ struct ref_matmul_t : public primitive_t {
         ref_post_ops
                 = utils::make_unique<ref_post_ops_t>(pd()->attr()->post_ops_);
         if (!ref_post_ops) return status::out_of_memory;
+        if (pd()->with_glu()) {
+            const auto &po = pd()->attr()->post_ops_;
+            glu_eltwise = utils::make_unique<ref_eltwise_scalar_fwd_t>(
+                    po.entry_[po.find(primitive_kind::glu)].glu);
+            if (!glu_eltwise) return status::out_of_memory;
+        }
         return status::success;
     }
 
@@ -96,6 +111,7 @@ private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
     status_t execute_ref(const exec_ctx_t &ctx) const;
     std::unique_ptr<ref_post_ops_t> ref_post_ops;
+    std::unique_ptr<ref_eltwise_scalar_fwd_t> glu_eltwise;
 };
 
 } // namespace matmul
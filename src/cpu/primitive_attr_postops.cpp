@@ -254,7 +254,7 @@ status_t ref_post_ops_t::execute(float &res, const args_t &args) const {
     auto it_binary_po = binary_po_.begin();
     for (auto idx = 0; idx < po_.len(); ++idx) {
         const auto &e = po_.entry_[idx];
-        switch (e.kind) {
+        switch ((int)e.kind) {
             case primitive_kind::sum:
                 if (!skip_sum_) {
                     res += e.sum.scale
@@ -301,6 +301,10 @@ status_t ref_post_ops_t::execute(float &res, const args_t &args) const {
                 const auto &weights_value = prelu_weights[off];
                 res = weights_value * res;
             } break;
+            case primitive_kind::glu:
+                // Gating combines two results, so it is applied by the
+                // primitive itself.
+                break;
             default: assert(!"unsupported post op primitive kind!");
         }
     }
@@ -69,7 +69,7 @@ status_t ref_binary_t::execute_ref(const exec_ctx_t &ctx) const {
         if (has_postops || !dst_d.is_dense(true)) {
             // Use zero-padding implementation as we cannot memset over
             // populated dst memory or submemories.
-            ctx.zero_pad_output(DNNL_ARG_TO);
+            ctx.output(DNNL_ARG_TO)->ensure_zero_padded(ctx);
         } else {
             const auto res = std::div(static_cast<int>(dst_d.size()), PAGE_4K);
             if (!res.quot)
@@ -167,7 +167,9 @@ struct ref_convolution_bwd_weights_t : public primitive_t {
                     && utils::one_of(diff_wei_type, f32, src_type)
                     && utils::one_of(
                             diff_bia_type, data_type::undef, f32, src_type)
-                    && set_default_formats() && attr()->has_default_values();
+                    && set_default_formats()
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops);
             return ok ? status::success : status::unimplemented;
         }
 
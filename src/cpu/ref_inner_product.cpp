@@ -163,6 +163,8 @@ status_t ref_inner_product_bwd_weights_t::execute_backward_weights(
     const auto OC = pd()->OC();
     const auto IC = pd()->IC();
 
+    const bool with_accumulation = pd()->with_accumulation();
+
     parallel_nd(OC, IC, [&](dim_t oc, dim_t ic) {
         const dim_t KD = pd()->KD();
         const dim_t KH = pd()->KH();
@@ -170,7 +172,12 @@ status_t ref_inner_product_bwd_weights_t::execute_backward_weights(
         for_(dim_t kd = 0; kd < KD; ++kd)
         for_(dim_t kh = 0; kh < KH; ++kh)
         for (dim_t kw = 0; kw < KW; ++kw) {
-            float dw = 0;
+            const auto diff_wei_off = ref_ip_utils::get_weights_off(
+                    diff_weights_d, ndims, oc, ic, kd, kh, kw);
+            float dw = with_accumulation
+                    ? io::load_float_value(diff_weights_d.data_type(),
+                            diff_weights, diff_wei_off)
+                    : 0.f;
             for (dim_t mb = 0; mb < MB; ++mb) {
                 const auto diff_dst_off = ref_ip_utils::get_data_off(
                         diff_dst_d, 2, mb, oc, 0, 0, 0);
@@ -182,8 +189,6 @@ status_t ref_inner_product_bwd_weights_t::execute_backward_weights(
                         = io::load_float_value(src_d.data_type(), src, src_off);
                 dw += dd * s;
             }
-            const auto diff_wei_off = ref_ip_utils::get_weights_off(
-                    diff_weights_d, ndims, oc, ic, kd, kh, kw);
             io::store_float_value(
                     diff_weights_d.data_type(), dw, diff_weights, diff_wei_off);
         }
@@ -191,7 +196,11 @@ status_t ref_inner_product_bwd_weights_t::execute_backward_weights(
 
     if (diff_bias) {
         parallel_nd(OC, [&](dim_t oc) {
-            float db = 0;
+            const auto diff_bia_off = diff_bias_d.off(oc);
+            float db = with_accumulation
+                    ? io::load_float_value(
+                            diff_bias_d.data_type(), diff_bias, diff_bia_off)
+                    : 0.f;
             for (dim_t mb = 0; mb < MB; ++mb) {
                 const auto diff_dst_off = ref_ip_utils::get_data_off(
                         diff_dst_d, 2, mb, oc, 0, 0, 0);
@@ -200,7 +209,6 @@ status_t ref_inner_product_bwd_weights_t::execute_backward_weights(
                 db += dd;
             }
 
-            const auto diff_bia_off = diff_bias_d.off(oc);
             io::store_float_value(
                     diff_bias_d.data_type(), db, diff_bias, diff_bia_off);
         });
@@ -148,7 +148,9 @@ struct ref_inner_product_bwd_weights_t : public primitive_t {
                     && utils::one_of(diff_wei_type, f32, src_type)
                     && IMPLICATION(with_bias(),
                             utils::one_of(diff_bia_type, f32, src_type))
-                    && diff_dst_type == src_type && attr()->has_default_values()
+                    && diff_dst_type == src_type
+                    && attr()->has_default_values(
+                            primitive_attr_t::skip_mask_t::post_ops)
                     && set_default_params(allow_all_tags) == status::success;
             return ok ? status::success : status::unimplemented;
         }
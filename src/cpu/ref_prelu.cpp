@@ -75,7 +75,8 @@ status_t ref_prelu_fwd_t::execute_forward(const exec_ctx_t &ctx) const {
     const memory_desc_wrapper weights_d(pd()->weights_md(0));
     const auto is_inplace = (src == dst);
     const auto has_padding = is_padding(data_d);
-    if (has_padding && !is_inplace) ctx.zero_pad_output(DNNL_ARG_TO);
+    if (has_padding && !is_inplace)
+        ctx.output(DNNL_ARG_DST)->ensure_zero_padded(ctx);
 
     const int mask = utils::get_dims_mask(
             data_d.dims(), weights_d.dims(), data_d.ndims());
@@ -372,9 +373,10 @@ status_t ref_prelu_bwd_t::execute_backward(const exec_ctx_t &ctx) const {
 
     const auto is_inplace = (diff_src == diff_dst);
     if (is_padding(diff_src_d) && !is_inplace)
-        ctx.zero_pad_output(DNNL_ARG_DIFF_SRC);
+        ctx.output(DNNL_ARG_DIFF_SRC)->ensure_zero_padded(ctx);
 
-    if (is_padding(diff_weights_d)) ctx.zero_pad_output(DNNL_ARG_DIFF_WEIGHTS);
+    if (is_padding(diff_weights_d))
+        ctx.output(DNNL_ARG_DIFF_WEIGHTS)->ensure_zero_padded(ctx);
 
     switch (bcast_type) {
         case broadcasting_strategy_t::scalar:
@@ -224,7 +224,7 @@ status_t ref_softmax_fwd_t::execute_forward_generic(
                 });
         } else
             // needed for submemory correctness
-            ctx.zero_pad_output(DNNL_ARG_DST);
+            ctx.output(DNNL_ARG_DST)->ensure_zero_padded(ctx);
     }
 
     const auto axis_size = pd()->axis_size(true);
@@ -383,7 +383,7 @@ status_t ref_softmax_bwd_t::execute_backward_generic(
                 });
         } else
             // needed for submemory correctness
-            ctx.zero_pad_output(DNNL_ARG_DIFF_SRC);
+            ctx.output(DNNL_ARG_DIFF_SRC)->ensure_zero_padded(ctx);
     }
 
     parallel_nd(outer_size_, inner_size_, [&](dim_t ou, dim_t in) {
@@ -438,7 +438,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         // This kernel is used primarily for tensors with multiple inner
         // blocks for which generic zero padding must be used.
         // TODO: apply zero padding inside parallel_nd()
-        ctx.zero_pad_output(DNNL_ARG_TO);
+        ctx.output(DNNL_ARG_TO)->ensure_zero_padded(ctx);
 
         auto ker = [&](const data_t<type_i> *inp, data_t<type_o> *out,
                            int32_t *c, int32_t *zp, const float *s,
@@ -779,7 +779,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         // This kernel is used primarily for tensors with multiple inner
         // blocks for which generic zero padding must be used.
         // TODO: apply zero padding inside parallel_nd()
-        ctx.zero_pad_output(DNNL_ARG_TO);
+        ctx.output(DNNL_ARG_TO)->ensure_zero_padded(ctx);
 
         auto ker = [&](const data_t<type_i> *inp, data_t<type_o> *out,
                            int32_t *zp, const float *s, const float *d,
@@ -2102,7 +2102,7 @@ struct simple_reorder_impl<SIMPLE_REORDER_TEMPL_CALL,
         // This kernel is used also for tensors with multiple inner
         // blocks for which generic zero padding must be used.
         // TODO: apply zero padding inside parallel_nd()
-        ctx.zero_pad_output(DNNL_ARG_TO);
+        ctx.output(DNNL_ARG_TO)->ensure_zero_padded(ctx);
 
         parallel_nd(D_start, D_mask, D_rest,
                 [&](ptrdiff_t ds, ptrdiff_t dm, ptrdiff_t dr) {
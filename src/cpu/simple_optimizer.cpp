@@ -0,0 +1,294 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+
+#include "common/bfloat16.hpp"
+#include "common/float16.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/simple_optimizer.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// The number of elements converted to f32 and updated at once.
+constexpr dim_t block_size = 1024;
+
+void cvt_to_f32(float *out, const void *in, data_type_t dt, dim_t nelems) {
+    switch (dt) {
+        case data_type::bf16:
+            cvt_bfloat16_to_float(out, (const bfloat16_t *)in, nelems);
+            break;
+        case data_type::f16:
+            cvt_float16_to_float(out, (const float16_t *)in, nelems);
+            break;
+        default: std::memcpy(out, in, nelems * sizeof(float));
+    }
+}
+
+void cvt_from_f32(void *out, const float *in, data_type_t dt, dim_t nelems) {
+    switch (dt) {
+        case data_type::bf16:
+            cvt_float_to_bfloat16((bfloat16_t *)out, in, nelems);
+            break;
+        case data_type::f16:
+            cvt_float_to_float16((float16_t *)out, in, nelems);
+            break;
+        default: std::memcpy(out, in, nelems * sizeof(float));
+    }
+}
+
+struct update_params_t {
+    alg_kind_t alg;
+    float lr, beta_1, beta_2, epsilon, weight_decay;
+    // The common scale of the gradient.
+    float scale;
+    // The bias corrections of the moments: 1 - beta ^ step.
+    float bias_correction_1, bias_correction_2;
+    // LAMB only: the ratio of the norms of the weights and of the update.
+    float trust_ratio;
+};
+
+// Updates a block of weights in place, and returns the sum of squares of
+// the scaled gradient. The moments are updated in place as well.
+float update_block(const update_params_t &p, float *wei, const float *diff_wei,
+        float *m1, float *m2, dim_t len) {
+    using namespace alg_kind;
+    const float lr = p.lr, b1 = p.beta_1, b2 = p.beta_2, eps = p.epsilon;
+    const float wd = p.weight_decay, scale = p.scale;
+    float diff_wei_sq = 0.f;
+
+    switch (p.alg) {
+        case optimizer_sgd:
+            if (m1) {
+                PRAGMA_OMP_SIMD(reduction(+ : diff_wei_sq))
+                for (dim_t i = 0; i < len; ++i) {
+                    const float g = scale * diff_wei[i];
+                    diff_wei_sq += g * g;
+                    m1[i] = b1 * m1[i] + g + wd * wei[i];
+                    wei[i] -= lr * m1[i];
+                }
+            } else {
+                PRAGMA_OMP_SIMD(reduction(+ : diff_wei_sq))
+                for (dim_t i = 0; i < len; ++i) {
+                    const float g = scale * diff_wei[i];
+                    diff_wei_sq += g * g;
+                    wei[i] -= lr * (g + wd * wei[i]);
+                }
+            }
+            break;
+        case optimizer_adam:
+        case optimizer_adamw: {
+            // Adam adds the weight decay to the gradient, while AdamW applies
+            // it to the weights directly.
+            const float l2 = p.alg == optimizer_adam ? wd : 0.f;
+            const float decay = p.alg == optimizer_adamw ? 1.f - lr * wd : 1.f;
+            const float step_size = lr / p.bias_correction_1;
+            const float rsqrt_bc2 = 1.f / std::sqrt(p.bias_correction_2);
+            PRAGMA_OMP_SIMD(reduction(+ : diff_wei_sq))
+            for (dim_t i = 0; i < len; ++i) {
+                const float g0 = scale * diff_wei[i];
+                diff_wei_sq += g0 * g0;
+                const float g = g0 + l2 * wei[i];
+                m1[i] = b1 * m1[i] + (1.f - b1) * g;
+                m2[i] = b2 * m2[i] + (1.f - b2) * g * g;
+                const float denom = std::sqrt(m2[i]) * rsqrt_bc2 + eps;
+                wei[i] = decay * wei[i] - step_size * m1[i] / denom;
+            }
+            break;
+        }
+        case optimizer_lamb: {
+            // The moments are updated by lamb_moments_block(), here only the
+            // update scaled by the trust ratio is applied.
+            const float step_size = lr * p.trust_ratio;
+            const float rbc1 = 1.f / p.bias_correction_1;
+            const float rsqrt_bc2 = 1.f / std::sqrt(p.bias_correction_2);
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; ++i) {
+                const float denom = std::sqrt(m2[i]) * rsqrt_bc2 + eps;
+                const float r = m1[i] * rbc1 / denom + wd * wei[i];
+                wei[i] -= step_size * r;
+            }
+            break;
+        }
+        default: assert(!"unknown optimizer algorithm");
+    }
+    return diff_wei_sq;
+}
+
+// The first pass of LAMB: updates the moments and accumulates the sums of
+// squares of the scaled gradient, the weights, and the update.
+void lamb_moments_block(const update_params_t &p, const float *wei,
+        const float *diff_wei, float *m1, float *m2, dim_t len,
+        float &diff_wei_sq, float &wei_sq, float &update_sq) {
+    const float b1 = p.beta_1, b2 = p.beta_2, eps = p.epsilon;
+    const float wd = p.weight_decay, scale = p.scale;
+    const float rbc1 = 1.f / p.bias_correction_1;
+    const float rsqrt_bc2 = 1.f / std::sqrt(p.bias_correction_2);
+    float g_sq = 0.f, w_sq = 0.f, r_sq = 0.f;
+    PRAGMA_OMP_SIMD(reduction(+ : g_sq, w_sq, r_sq))
+    for (dim_t i = 0; i < len; ++i) {
+        const float g = scale * diff_wei[i];
+        g_sq += g * g;
+        m1[i] = b1 * m1[i] + (1.f - b1) * g;
+        m2[i] = b2 * m2[i] + (1.f - b2) * g * g;
+        const float denom = std::sqrt(m2[i]) * rsqrt_bc2 + eps;
+        const float r = m1[i] * rbc1 / denom + wd * wei[i];
+        w_sq += wei[i] * wei[i];
+        r_sq += r * r;
+    }
+    diff_wei_sq = g_sq;
+    wei_sq = w_sq;
+    update_sq = r_sq;
+}
+
+} // namespace
+
+status_t simple_optimizer_t::execute(const exec_ctx_t &ctx) const {
+    using namespace memory_tracking::names;
+
+    const memory_desc_wrapper wei_d(pd()->weights_md());
+    const memory_desc_wrapper diff_wei_d(pd()->diff_weights_md());
+    const data_type_t wei_dt = wei_d.data_type();
+    const data_type_t diff_wei_dt = diff_wei_d.data_type();
+
+    auto weights = CTX_OUT_MEM(char *, DNNL_ARG_WEIGHTS)
+            + wei_d.offset0() * wei_d.data_type_size();
+    auto diff_weights = CTX_IN_MEM(const char *, DNNL_ARG_DIFF_WEIGHTS)
+            + diff_wei_d.offset0() * diff_wei_d.data_type_size();
+    auto master_weights = CTX_OUT_MEM(float *, DNNL_ARG_MASTER_WEIGHTS);
+    auto moment_1 = CTX_OUT_MEM(float *, DNNL_ARG_MOMENT_1);
+    auto moment_2 = CTX_OUT_MEM(float *, DNNL_ARG_MOMENT_2);
+    auto diff_weights_norm = CTX_OUT_MEM(float *, DNNL_ARG_DIFF_WEIGHTS_NORM);
+    auto learning_rate = CTX_IN_MEM(const float *, DNNL_ARG_LEARNING_RATE);
+    DEFINE_ARG_SCALES_BUFFER(scales, DNNL_ARG_DIFF_WEIGHTS);
+
+    const auto desc = pd()->desc();
+    update_params_t p;
+    p.alg = desc->alg_kind;
+    p.lr = learning_rate[0];
+    p.beta_1 = desc->beta_1;
+    p.beta_2 = desc->beta_2;
+    p.epsilon = desc->epsilon;
+    p.weight_decay = desc->weight_decay;
+    p.scale = scales[0];
+    p.bias_correction_1 = 1.f;
+    p.bias_correction_2 = 1.f;
+    p.trust_ratio = 1.f;
+    if (pd()->use_step()) {
+        const int32_t step = CTX_IN_MEM(const int32_t *, DNNL_ARG_STEP)[0];
+        if (step <= 0) return status::invalid_arguments;
+        p.bias_correction_1 = 1.f - std::pow(p.beta_1, (float)step);
+        p.bias_correction_2 = 1.f - std::pow(p.beta_2, (float)step);
+    }
+
+    const dim_t nelems = pd()->nelems();
+    const dim_t nblocks = utils::div_up(nelems, block_size);
+    const bool is_lamb = p.alg == alg_kind::optimizer_lamb;
+    const int nthr = pd()->nthr_;
+
+    auto scratchpad = ctx.get_scratchpad_grantor();
+    auto sums = scratchpad.template get<double>(key_optimizer_reduction);
+    utils::array_set(sums, 0.0, 3 * nthr);
+
+    // Runs over the blocks of the weights. The weights are updated in place
+    // unless the pass only computes the LAMB norms.
+    auto run_pass = [&](bool lamb_norms) {
+        parallel(nthr, [&](const int ithr, const int nthr) {
+            dim_t start {0}, end {0};
+            balance211(nblocks, nthr, ithr, start, end);
+
+            float wei_buf[block_size];
+            float diff_wei_buf[block_size];
+            double diff_wei_sq = 0, wei_sq = 0, update_sq = 0;
+            for (dim_t ib = start; ib < end; ++ib) {
+                const dim_t off = ib * block_size;
+                const dim_t len = nstl::min(block_size, nelems - off);
+                char *wei_blk = weights + off * wei_d.data_type_size();
+
+                float *wei = wei_buf;
+                if (master_weights)
+                    wei = master_weights + off;
+                else if (wei_dt == data_type::f32)
+                    wei = (float *)wei_blk;
+                else
+                    cvt_to_f32(wei, wei_blk, wei_dt, len);
+
+                const float *diff_wei = diff_wei_buf;
+                const char *diff_wei_blk
+                        = diff_weights + off * diff_wei_d.data_type_size();
+                if (diff_wei_dt == data_type::f32)
+                    diff_wei = (const float *)diff_wei_blk;
+                else
+                    cvt_to_f32(diff_wei_buf, diff_wei_blk, diff_wei_dt, len);
+
+                float *m1 = moment_1 ? moment_1 + off : nullptr;
+                float *m2 = moment_2 ? moment_2 + off : nullptr;
+
+                if (lamb_norms) {
+                    float g_sq, w_sq, r_sq;
+                    lamb_moments_block(
+                            p, wei, diff_wei, m1, m2, len, g_sq, w_sq, r_sq);
+                    diff_wei_sq += g_sq;
+                    wei_sq += w_sq;
+                    update_sq += r_sq;
+                    continue;
+                }
+
+                diff_wei_sq += update_block(p, wei, diff_wei, m1, m2, len);
+                if (wei != (float *)wei_blk)
+                    cvt_from_f32(wei_blk, wei, wei_dt, len);
+            }
+            sums[3 * ithr + 0] += diff_wei_sq;
+            sums[3 * ithr + 1] += wei_sq;
+            sums[3 * ithr + 2] += update_sq;
+        });
+    };
+
+    // LAMB needs the norms of the weights and of the update over the whole
+    // tensor before any weights are changed, hence the extra pass. The tensor
+    // is not split into layers, so there is one trust ratio for all of it.
+    if (is_lamb) {
+        run_pass(true);
+        double wei_sq = 0, update_sq = 0;
+        for (int ithr = 0; ithr < nthr; ++ithr) {
+            wei_sq += sums[3 * ithr + 1];
+            update_sq += sums[3 * ithr + 2];
+        }
+        const double wei_norm = std::sqrt(wei_sq);
+        const double update_norm = std::sqrt(update_sq);
+        if (wei_norm > 0 && update_norm > 0)
+            p.trust_ratio = (float)(wei_norm / update_norm);
+    }
+    run_pass(false);
+
+    if (diff_weights_norm) {
+        double diff_wei_sq = 0;
+        for (int ithr = 0; ithr < nthr; ++ithr)
+            diff_wei_sq += sums[3 * ithr + 0];
+        diff_weights_norm[0] = (float)diff_wei_sq;
+    }
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
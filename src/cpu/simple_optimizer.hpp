@@ -0,0 +1,102 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#ifndef CPU_SIMPLE_OPTIMIZER_HPP
+#define CPU_SIMPLE_OPTIMIZER_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/dnnl_thread.hpp"
+#include "common/memory_tracking.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_optimizer_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Updates all the elements of the weights in a single pass (two passes for
+// LAMB, which needs the norms of the weights and of the update first). The
+// elements are processed in blocks that are converted to f32 if needed, so
+// that the update itself is a plain loop over f32 arrays.
+struct simple_optimizer_t : public primitive_t {
+    struct pd_t : public cpu_optimizer_pd_t {
+        using cpu_optimizer_pd_t::cpu_optimizer_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_optimizer_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            const auto wei_dt = weights_md()->data_type;
+            const auto diff_wei_dt = diff_weights_md()->data_type;
+            VDISPATCH_OPTIMIZER(utils::one_of(wei_dt, f32, bf16, f16)
+                            && platform::has_data_type_support(wei_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_OPTIMIZER(utils::one_of(diff_wei_dt, f32, bf16, f16)
+                            && platform::has_data_type_support(diff_wei_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_OPTIMIZER(
+                    attr()->has_default_values(skip_mask_t::scales_runtime),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_OPTIMIZER(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            // Padded layouts are not supported: the padding of the weights
+            // has to stay zero, while that of the moments is not guaranteed
+            // to be zero.
+            const memory_desc_wrapper wei_d(weights_md());
+            const memory_desc_wrapper diff_wei_d(diff_weights_md());
+            VDISPATCH_OPTIMIZER(wei_d.is_dense() && diff_wei_d.is_dense(),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_OPTIMIZER(wei_d.similar_to(diff_wei_d, true, false),
+                    VERBOSE_INCONSISTENT_MDS, "weights", "diff_weights");
+
+            nthr_ = dnnl_get_max_threads();
+            init_scratchpad();
+            return status::success;
+        }
+
+        int nthr_; // To not exceed the limit in execute used for set up.
+
+    private:
+        void init_scratchpad() {
+            using namespace memory_tracking::names;
+            auto scratchpad = scratchpad_registry().registrar();
+            // Per thread sums of squares of the gradient, the weights and the
+            // update.
+            scratchpad.template book<double>(
+                    key_optimizer_reduction, 3 * nthr_);
+        }
+    };
+
+    simple_optimizer_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -0,0 +1,158 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+#include <cstring>
+#include <float.h>
+
+#include "common/dnnl_thread.hpp"
+
+#include "cpu/cpu_primitive.hpp"
+#include "cpu/simple_softmax_cross_entropy.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+namespace {
+
+// The number of logits converted to f32 and processed at once.
+constexpr dim_t block_size = 1024;
+
+// Returns a pointer to `len` logits in f32 starting at `off`, converting
+// them into `buf` unless they are f32 already.
+const float *load_block(float *buf, const char *row, data_type_t dt,
+        dim_t off, dim_t len) {
+    const char *ptr = row + off * types::data_type_size(dt);
+    if (dt == data_type::f32) return (const float *)ptr;
+    types::cvt_to_float(dt, buf, ptr, len);
+    return buf;
+}
+
+} // namespace
+
+status_t simple_softmax_cross_entropy_t::execute(const exec_ctx_t &ctx) const {
+    const memory_desc_wrapper src_d(pd()->src_md());
+    const memory_desc_wrapper labels_d(pd()->arg_md(DNNL_ARG_LABELS));
+    const memory_desc_wrapper dst_d(pd()->dst_md());
+    const memory_desc_wrapper diff_src_d(pd()->diff_src_md());
+    const data_type_t src_dt = src_d.data_type();
+    const data_type_t diff_src_dt = diff_src_d.data_type();
+
+    auto src = CTX_IN_MEM(const char *, DNNL_ARG_SRC)
+            + src_d.offset0() * src_d.data_type_size();
+    auto labels
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_LABELS) + labels_d.offset0();
+    auto dst = CTX_OUT_MEM(float *, DNNL_ARG_DST) + dst_d.offset0();
+    const bool with_diff_src = pd()->with_diff_src();
+    char *diff_src = nullptr;
+    if (with_diff_src)
+        diff_src = CTX_OUT_MEM(char *, DNNL_ARG_DIFF_SRC)
+                + diff_src_d.offset0() * diff_src_d.data_type_size();
+    DEFINE_ARG_SCALES_BUFFER(scales, DNNL_ARG_DIFF_SRC);
+
+    const dim_t N = pd()->batch();
+    const dim_t C = pd()->classes();
+    const dim_t src_ld = src_d.blocking_desc().strides[0];
+    const dim_t diff_src_ld
+            = with_diff_src ? diff_src_d.blocking_desc().strides[0] : 0;
+
+    // Negative labels mark ignored samples. Labels past the number of
+    // classes are an error, checked before anything is written.
+    for (dim_t n = 0; n < N; ++n)
+        if (labels[n] >= C) return status::invalid_arguments;
+
+    const float smoothing = pd()->desc()->label_smoothing;
+    const float off_target = smoothing / C;
+    const float on_target = 1.f - smoothing;
+    const float scale = scales[0];
+    const dim_t nblocks = utils::div_up(C, block_size);
+
+    parallel_nd(N, [&](dim_t n) {
+        const int32_t label = labels[n];
+        const char *src_row = src + n * src_ld * src_d.data_type_size();
+        char *diff_src_row = with_diff_src
+                ? diff_src + n * diff_src_ld * diff_src_d.data_type_size()
+                : nullptr;
+
+        if (label < 0) {
+            dst[n] = 0.f;
+            if (with_diff_src)
+                std::memset(diff_src_row, 0, C * diff_src_d.data_type_size());
+            return;
+        }
+
+        // Pass 1: the running maximum, the sum of exponents relative to it,
+        // and the sum of the logits for the smoothing term.
+        float buf[block_size];
+        float max = -FLT_MAX, sum_exp = 0.f, sum = 0.f;
+        for (dim_t ib = 0; ib < nblocks; ++ib) {
+            const dim_t off = ib * block_size;
+            const dim_t len = nstl::min(block_size, C - off);
+            const float *x = load_block(buf, src_row, src_dt, off, len);
+
+            float blk_max = max;
+            for (dim_t i = 0; i < len; ++i)
+                blk_max = nstl::max(blk_max, x[i]);
+            if (blk_max > max) {
+                sum_exp *= ::expf(max - blk_max);
+                max = blk_max;
+            }
+            float blk_sum_exp = 0.f, blk_sum = 0.f;
+            PRAGMA_OMP_SIMD(reduction(+ : blk_sum_exp, blk_sum))
+            for (dim_t i = 0; i < len; ++i) {
+                blk_sum_exp += ::expf(x[i] - max);
+                blk_sum += x[i];
+            }
+            sum_exp += blk_sum_exp;
+            sum += blk_sum;
+        }
+        const float lse = max + ::logf(sum_exp);
+        const float x_label = *load_block(buf, src_row, src_dt, label, 1);
+        dst[n] = lse - on_target * x_label - off_target * sum;
+
+        if (!with_diff_src) return;
+
+        // Pass 2: the gradient, softmax minus the smoothed one-hot labels.
+        float grad_buf[block_size];
+        for (dim_t ib = 0; ib < nblocks; ++ib) {
+            const dim_t off = ib * block_size;
+            const dim_t len = nstl::min(block_size, C - off);
+            const float *x = load_block(buf, src_row, src_dt, off, len);
+            float *grad = diff_src_dt == data_type::f32
+                    ? (float *)diff_src_row + off
+                    : grad_buf;
+
+            PRAGMA_OMP_SIMD()
+            for (dim_t i = 0; i < len; ++i)
+                grad[i] = scale * (::expf(x[i] - lse) - off_target);
+            if (off <= label && label < off + len)
+                grad[label - off] -= scale * on_target;
+
+            if (grad == grad_buf)
+                types::cvt_from_float(diff_src_dt,
+                        diff_src_row
+                                + off * types::data_type_size(diff_src_dt),
+                        grad_buf, len);
+        }
+    });
+
+    return status::success;
+}
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
@@ -0,0 +1,95 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#ifndef CPU_SIMPLE_SOFTMAX_CROSS_ENTROPY_HPP
+#define CPU_SIMPLE_SOFTMAX_CROSS_ENTROPY_HPP
+
+#include "common/c_types_map.hpp"
+#include "common/primitive.hpp"
+#include "common/type_helpers.hpp"
+
+#include "cpu/cpu_softmax_cross_entropy_pd.hpp"
+#include "cpu/platform.hpp"
+
+namespace dnnl {
+namespace impl {
+namespace cpu {
+
+// Computes the loss and the gradient of each row of logits without
+// materializing the probabilities. The first pass over a row finds its
+// log-sum-exp with an online rescaled sum, and the second pass (only if the
+// gradient is requested) writes softmax minus the smoothed one-hot labels.
+// The logits are processed in blocks that are converted to f32 if needed.
+struct simple_softmax_cross_entropy_t : public primitive_t {
+    struct pd_t : public cpu_softmax_cross_entropy_pd_t {
+        using cpu_softmax_cross_entropy_pd_t::cpu_softmax_cross_entropy_pd_t;
+
+        DECLARE_COMMON_PD_T("simple:any", simple_softmax_cross_entropy_t);
+
+        status_t init(engine_t *engine) {
+            using namespace data_type;
+            using skip_mask_t = primitive_attr_t::skip_mask_t;
+
+            const auto src_dt = src_md()->data_type;
+            const auto diff_src_dt = diff_src_md()->data_type;
+            VDISPATCH_SOFTMAX_CE(utils::one_of(src_dt, f32, bf16, f16)
+                            && platform::has_data_type_support(src_dt),
+                    VERBOSE_UNSUPPORTED_DT);
+            if (with_diff_src())
+                VDISPATCH_SOFTMAX_CE(utils::one_of(diff_src_dt, f32, bf16, f16)
+                                && platform::has_data_type_support(diff_src_dt),
+                        VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SOFTMAX_CE(dst_md()->data_type == f32,
+                    VERBOSE_UNSUPPORTED_DT);
+            VDISPATCH_SOFTMAX_CE(
+                    attr()->has_default_values(skip_mask_t::scales_runtime),
+                    VERBOSE_UNSUPPORTED_ATTR);
+            VDISPATCH_SOFTMAX_CE(set_default_params() == status::success,
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            // Each row of the logits and of the gradient has to be
+            // contiguous.
+            using namespace format_tag;
+            const memory_desc_wrapper src_d(src_md());
+            const memory_desc_wrapper labels_d(arg_md(DNNL_ARG_LABELS));
+            const memory_desc_wrapper dst_d(dst_md());
+            const memory_desc_wrapper diff_src_d(diff_src_md());
+            VDISPATCH_SOFTMAX_CE(
+                    src_d.matches_tag(ab), VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SOFTMAX_CE(
+                    IMPLICATION(with_diff_src(), diff_src_d.matches_tag(ab)),
+                    VERBOSE_UNSUPPORTED_TAG);
+            VDISPATCH_SOFTMAX_CE(
+                    labels_d.matches_tag(a) && dst_d.matches_tag(a),
+                    VERBOSE_UNSUPPORTED_TAG);
+
+            return status::success;
+        }
+    };
+
+    simple_softmax_cross_entropy_t(const pd_t *apd) : primitive_t(apd) {}
+
+    status_t execute(const exec_ctx_t &ctx) const override;
+
+private:
+    const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+};
+
+} // namespace cpu
+} // namespace impl
+} // namespace dnnl
+
+#endif
@@ -309,7 +309,9 @@ status_t brgemm_desc_set_postops(brgemm_t *brg, const primitive_attr_t *attr,
                                     broadcasting_strategy_t::per_mb_spatial,
                                     broadcasting_strategy_t::per_mb_w,
                                     broadcasting_strategy_t::per_w,
-                                    broadcasting_strategy_t::no_broadcast})))
+                                    broadcasting_strategy_t::no_broadcast,
+                                    broadcasting_strategy_t::
+                                            no_broadcast_strided})))
         return status::unimplemented;
 
     const auto sum_idx = post_ops.find(primitive_kind::sum);
@@ -60,7 +60,8 @@ struct jit_brgemm_amx_uker_base_t : public jit_generator {
                             broadcasting_strategy_t::per_mb_spatial,
                             broadcasting_strategy_t::per_mb_w,
                             broadcasting_strategy_t::per_w,
-                            broadcasting_strategy_t::no_broadcast};
+                            broadcasting_strategy_t::no_broadcast,
+                            broadcasting_strategy_t::no_broadcast_strided};
             const binary_injector::rhs_arg_static_params_t rhs_sp {
                     static_cast<size_t>(Xbyak::Zmm(1).getIdx()), this->r14,
                     this->r15, this->r13, preserve_gpr, preserve_vmm,
@@ -28,6 +28,8 @@ namespace cpu {
 namespace x64 {
 namespace binary_injector {
 
+// no_broadcast_strided is left out: only the hosts that list it in their own
+// strategy sets handle strided views.
 static bcast_set_t get_all_strategies_supported_by_injector() {
     return bcast_set_t {broadcasting_strategy_t::scalar,
             broadcasting_strategy_t::per_oc,
@@ -76,6 +78,39 @@ static bool src1_desc_layout_same_as_dst_d(
             && lhs.offset0 == rhs.offset0;
 }
 
+// Returns dimensions of dst in the order of decreasing strides skipping the
+// dimensions of size one, so an offset in dst can be decomposed into logical
+// indices by consecutive divisions.
+static std::vector<int> get_strided_view_dims_order(
+        const memory_desc_wrapper &dst_d) {
+    const auto &strides = dst_d.blocking_desc().strides;
+    std::vector<int> order;
+    for (int d = 0; d < dst_d.ndims(); ++d)
+        if (dst_d.dims()[d] != 1) order.push_back(d);
+    std::sort(order.begin(), order.end(),
+            [&](int a, int b) { return strides[a] > strides[b]; });
+    return order;
+}
+
+static bool src1_desc_is_supported_strided_view(
+        const dnnl::impl::memory_desc_t &src1_desc,
+        const memory_desc_wrapper &dst_d) {
+    if (dst_d.md_ == nullptr) return false;
+    const memory_desc_wrapper src1_d(src1_desc);
+    if (!dst_d.is_plain() || !src1_d.is_plain()
+            || dst_d.has_runtime_dims_or_strides()
+            || src1_d.has_runtime_dims_or_strides())
+        return false;
+
+    // Vector loads of src1 are contiguous, so the innermost dimension of dst
+    // has to be dense in src1 as well.
+    const auto order = get_strided_view_dims_order(dst_d);
+    if (order.empty()) return true;
+    const int inner_dim = order.back();
+    return dst_d.blocking_desc().strides[inner_dim] == 1
+            && src1_d.blocking_desc().strides[inner_dim] == 1;
+}
+
 bool is_bcast_supported(const dnnl::impl::memory_desc_t &src1_desc,
         const memory_desc_wrapper &dst_d,
         const bcast_set_t &supported_strategy_set) {
@@ -87,6 +122,11 @@ bool is_bcast_supported(const dnnl::impl::memory_desc_t &src1_desc,
         if (!src1_desc_layout_same_as_dst_d(src1_desc, dst_d)) return false;
     }
 
+    if (bcast_type == broadcasting_strategy_t::no_broadcast_strided) {
+        if (!src1_desc_is_supported_strided_view(src1_desc, dst_d))
+            return false;
+    }
+
     return bcast_type != broadcasting_strategy_t::unsupported;
 }
 
@@ -416,9 +456,16 @@ void jit_uni_binary_injector_t<isa, Vmm>::compute_vector_range(
                     broadcasting_strategy_t::per_mb_w);
     const bool should_preserve_w_offset_conversion_regs = use_offset_conversions
             && rhs_broadcasting_strategy == broadcasting_strategy_t::per_w;
+    // Strided view offsets are converted with the same registers as the ones
+    // used for per_oc and per_w strategies.
+    const bool should_preserve_strided_offset_conversion_regs
+            = use_offset_conversions
+            && rhs_broadcasting_strategy
+                    == broadcasting_strategy_t::no_broadcast_strided;
     const bool should_preserve_w_or_oc_offset_conversion_regs
             = should_preserve_oc_offset_conversion_regs
-            || should_preserve_w_offset_conversion_regs;
+            || should_preserve_w_offset_conversion_regs
+            || should_preserve_strided_offset_conversion_regs;
 
     // Phase 2 Protect temporary registers content.
     const injector_utils::register_preserve_guard_t register_guard {host_,
@@ -544,6 +591,16 @@ Xbyak::Address jit_uni_binary_injector_t<isa, Vmm>::prepare_rhs_arg_addr(
 
             return host_->ptr[rhs_addr_reg];
         }
+        case broadcasting_strategy_t::no_broadcast_strided: {
+            append_no_broadcast_strided_offset(
+                    get_src1_desc(post_op, rhs_arg_static_params_.dst_d),
+                    rhs_arg_params.vmm_idx_to_out_addr,
+                    rhs_arg_params.vmm_idx_to_out_reg,
+                    rhs_arg_params.vmm_idx_to_out_elem_off_val, vmm_idx,
+                    rhs_addr_reg, rhs_helper_reg, rhs_arg_elem_size, is_first);
+
+            return host_->ptr[rhs_addr_reg];
+        }
         case broadcasting_strategy_t::per_oc:
         case broadcasting_strategy_t::per_oc_spatial: {
             append_oc_offset(rhs_arg_params.vmm_idx_to_out_addr,
@@ -647,6 +704,115 @@ void jit_uni_binary_injector_t<isa, Vmm>::calculate_no_broadcast_partial(
                                 : offset_adj);
 }
 
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_injector_t<isa, Vmm>::append_no_broadcast_strided_offset(
+        const memory_desc_t &src1_desc,
+        const std::map<int, Xbyak::Address> &vmm_idx_to_out_addr,
+        const std::map<int, Xbyak::Reg64> &vmm_idx_to_out_reg,
+        const std::map<int, size_t> &vmm_idx_to_out_elem_off_val, int vmm_idx,
+        const Xbyak::Reg64 &addr_reg, const Xbyak::Reg64 &tmp_reg,
+        std::size_t elem_size_bytes, bool is_first) const {
+
+    const auto it_out_addr = vmm_idx_to_out_addr.find(vmm_idx);
+    const auto it_out_reg = vmm_idx_to_out_reg.find(vmm_idx);
+
+    const bool is_out_addr = it_out_addr != vmm_idx_to_out_addr.end();
+    const bool is_out_reg = it_out_reg != vmm_idx_to_out_reg.end();
+
+    if (is_out_addr || is_out_reg) {
+        Xbyak::Address out_addr = is_out_addr ? it_out_addr->second
+                                              : host_->ptr[it_out_reg->second];
+        const auto it_off_val = vmm_idx_to_out_elem_off_val.find(vmm_idx);
+        const auto &addr_cache_reg = rhs_arg_static_params_.rhs_addr_cache_reg;
+
+        if (is_first) {
+            calculate_no_broadcast_base(out_addr, tmp_reg);
+
+            const auto rax = host_->rax;
+            const auto rdx = host_->rdx;
+            const auto r8 = host_->r8;
+
+            const injector_utils::conditional_register_preserve_guard_t
+                    register_guard {is_out_reg ? utils::one_of(
+                                            it_out_reg->second, rax, rdx, r8)
+                                               : false,
+                            host_, {it_out_reg->second}};
+
+            calculate_no_broadcast_strided_base(src1_desc, tmp_reg);
+
+            if (elem_size_bytes == 1) {
+                host_->add(addr_reg, rax);
+            } else {
+                const int shift_val = std::log2(elem_size_bytes);
+                host_->mov(tmp_reg, rax);
+                host_->sal(tmp_reg, shift_val);
+                host_->add(addr_reg, tmp_reg);
+            }
+            host_->mov(addr_cache_reg, addr_reg);
+        } else {
+            host_->mov(addr_reg, addr_cache_reg);
+        }
+
+        if (it_off_val != vmm_idx_to_out_elem_off_val.end()) {
+            calculate_no_broadcast_strided_partial(
+                    src1_desc, it_off_val->second, tmp_reg, elem_size_bytes);
+            host_->add(addr_reg, tmp_reg);
+        }
+    }
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_injector_t<isa, Vmm>::calculate_no_broadcast_strided_base(
+        const memory_desc_t &src1_desc, const Xbyak::Reg64 &tmp_reg) const {
+    // off_src1 = offset0 + sum_d ((offset % str_dst[d - 1]) / str_dst[d])
+    //         * str_src1[d], where d goes in the order of decreasing strides
+    // output = rax
+    const auto &dst_d = rhs_arg_static_params_.dst_d;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    const auto &src1_strides = src1_desc.format_desc.blocking.strides;
+    const auto rax = host_->rax;
+    const auto rdx = host_->rdx;
+    const auto r8 = host_->r8;
+
+    host_->mov(rax, tmp_reg);
+    host_->mov(r8, src1_desc.offset0);
+    for (const int d : get_strided_view_dims_order(dst_d)) {
+        if (dst_strides[d] != 1) {
+            host_->mov(tmp_reg, dst_strides[d]);
+            host_->xor_(rdx, rdx);
+            host_->div(tmp_reg);
+        } else {
+            host_->xor_(rdx, rdx);
+        }
+        host_->mov(tmp_reg, src1_strides[d]);
+        host_->imul(rax, tmp_reg);
+        host_->add(r8, rax);
+        host_->mov(rax, rdx);
+    }
+    host_->mov(rax, r8);
+}
+
+template <cpu_isa_t isa, typename Vmm>
+void jit_uni_binary_injector_t<isa, Vmm>::
+        calculate_no_broadcast_strided_partial(const memory_desc_t &src1_desc,
+                const std::size_t offset, const Xbyak::Reg64 &tmp_reg,
+                std::size_t elem_size_bytes) const {
+    const auto &dst_d = rhs_arg_static_params_.dst_d;
+    const auto &dst_strides = dst_d.blocking_desc().strides;
+    const auto &src1_strides = src1_desc.format_desc.blocking.strides;
+
+    dim_t rem = offset
+            >> math::ilog2q(types::data_type_size(dst_d.data_type()));
+    dim_t offset_adj = 0;
+    for (const int d : get_strided_view_dims_order(dst_d)) {
+        offset_adj += (rem / dst_strides[d]) * src1_strides[d];
+        rem %= dst_strides[d];
+    }
+    host_->mov(tmp_reg,
+            elem_size_bytes > 1 ? offset_adj << math::ilog2q(elem_size_bytes)
+                                : offset_adj);
+}
+
 template <cpu_isa_t isa, typename Vmm>
 void jit_uni_binary_injector_t<isa, Vmm>::append_oc_offset(
         const std::map<int, Xbyak::Address> &vmm_idx_to_out_addr,
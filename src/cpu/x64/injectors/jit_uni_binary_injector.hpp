@@ -322,6 +322,19 @@ private:
     void calculate_no_broadcast_partial(const std::size_t offset,
             const Xbyak::Reg64 &out_reg, std::size_t elem_size_bytes) const;
 
+    void append_no_broadcast_strided_offset(const memory_desc_t &src1_desc,
+            const std::map<int, Xbyak::Address> &vmm_idx_to_out_addr,
+            const std::map<int, Xbyak::Reg64> &vmm_idx_to_out_reg,
+            const std::map<int, size_t> &vmm_idx_to_out_elem_off_val,
+            int vmm_idx, const Xbyak::Reg64 &addr_reg,
+            const Xbyak::Reg64 &tmp_reg, std::size_t elem_size_bytes,
+            bool is_first) const;
+    void calculate_no_broadcast_strided_base(
+            const memory_desc_t &src1_desc, const Xbyak::Reg64 &tmp_reg) const;
+    void calculate_no_broadcast_strided_partial(const memory_desc_t &src1_desc,
+            const std::size_t offset, const Xbyak::Reg64 &tmp_reg,
+            std::size_t elem_size_bytes) const;
+
     void append_oc_offset(
             const std::map<int, Xbyak::Address> &vmm_idx_to_out_addr,
             const std::map<int, Xbyak::Reg64> &vmm_idx_to_out_reg,
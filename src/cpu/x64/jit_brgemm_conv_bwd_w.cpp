@@ -49,7 +49,13 @@ status_t brgemm_convolution_bwd_weights_t::pd_t::init(engine_t *engine) {
             && utils::one_of(src_type, bf16, f16) && diff_dst_type == src_type
             && utils::one_of(diff_wei_type, f32, src_type)
             && utils::one_of(diff_bia_type, data_type::undef, f32, src_type)
-            && attr()->has_default_values() && !has_zero_dim_memory();
+            && attr()->has_default_values(
+                    primitive_attr_t::skip_mask_t::post_ops)
+            && IMPLICATION(with_accumulation(),
+                    diff_wei_type == f32
+                            && utils::one_of(diff_bia_type, data_type::undef,
+                                    f32))
+            && !has_zero_dim_memory();
     if (!ok) return status::unimplemented;
 
     auto scratchpad = scratchpad_registry().registrar();
@@ -734,7 +740,13 @@ struct brgemm_convolution_bwd_weights_t::thread_info_t {
         if (g_start >= g_end || oc_b_start >= oc_b_end
                 || ic_b_start >= ic_b_end)
             return false;
+        // The output the first mb group accumulates into is already
+        // initialized.
+        const bool accumulate_in_place
+                = pd()->with_accumulation() && ithr_mb == 0;
         if (start >= end) {
+            if (accumulate_in_place) return true;
+
             // for rare case if thread has no work by spatial dimension then we
             // need to initialize the output at least
             if (jcp.with_bias) {
@@ -768,7 +780,8 @@ struct brgemm_convolution_bwd_weights_t::thread_info_t {
             }
             return true;
         }
-        if (jcp.M < jcp.ic_block * jcp.nb_ic_blocking) {
+        if (!accumulate_in_place
+                && jcp.M < jcp.ic_block * jcp.nb_ic_blocking) {
             // For small ic we may calculate only needed part of diff_weights.
             // So we have to initialize diff_weights
             // TODO: initialize only not calculated part of diff_weights
@@ -839,6 +852,11 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_2d(
                     : ti->bia_reduction + (ti->ithr_mb - 1) * bias_buf_size;
     }
 
+    // With accumulation the first mb group adds to diff_weights and diff_bias
+    // directly, so it does not initialize them.
+    const bool accumulate_in_place
+            = _pd->with_accumulation() && ti->ithr_mb == 0;
+
     int img {0}, oh_s {0};
     int start = ti->img_start;
     int end = ti->img_end;
@@ -940,8 +958,8 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_2d(
 
                         bp.bias = diff_bias + g * rnd_up(jcp.oc, jcp.oc_block)
                                 + oc_b * jcp.oc_block;
-                        bp.channel
-                                = (start == ti->img_start) && (ohb_s == oh_s);
+                        bp.channel = (start == ti->img_start)
+                                && (ohb_s == oh_s) && !accumulate_in_place;
 
                         bp.os_index_begin = ohb_s;
                         bp.os_index_end = ohb_e;
@@ -960,7 +978,8 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_2d(
                             || ti->ic_b_start == ti->ic_b_end)
                         continue;
 
-                    const auto do_init = (start == ti->img_start);
+                    const auto do_init
+                            = (start == ti->img_start) && !accumulate_in_place;
 
                     for (int kh = 0; kh < jcp.kh; kh++) {
                         const int bs_ih_s = _pd->get_start_ih(kh, ohb_s);
@@ -1012,6 +1031,11 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_3d(
                     : ti->bia_reduction + (ti->ithr_mb - 1) * bias_buf_size;
     }
 
+    // With accumulation the first mb group adds to diff_weights and diff_bias
+    // directly, so it does not initialize them.
+    const bool accumulate_in_place
+            = _pd->with_accumulation() && ti->ithr_mb == 0;
+
     int img {0}, od_s {0};
     int start = ti->img_start;
     int end = ti->img_end;
@@ -1141,7 +1165,8 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_3d(
 
                                 bp.channel = (start == ti->img_start)
                                         && (odb_s == od_s) && (iodb == odb_s)
-                                        && (ohb_s == oh_s);
+                                        && (ohb_s == oh_s)
+                                        && !accumulate_in_place;
                                 bp.dst = ((diff_dst_data_t *)p_dst)
                                         + (iodb - od_s) * jcp.oh_block
                                                 * jcp.tr_ow * jcp.oc_block
@@ -1157,7 +1182,8 @@ void brgemm_convolution_bwd_weights_t::compute_diff_weights_3d(
                             continue;
 
                         const auto do_init
-                                = (start == ti->img_start && ohb_s == oh_s);
+                                = (start == ti->img_start && ohb_s == oh_s)
+                                && !accumulate_in_place;
 
                         for (int kd = 0; kd < jcp.kd; kd++) {
                             const int bs_id_s = _pd->get_start_id(kd, odb_s);
@@ -1449,6 +1475,18 @@ void brgemm_convolution_bwd_weights_t::prepare_scratchpad_data(
         simple_barrier::ctx_init(scratchpad.template get<simple_barrier::ctx_t>(
                 key_conv_wei_bia_reduction_bctx));
     }
+
+    if (pd()->with_accumulation() && pd()->with_bias()
+            && (jcp.oc % jcp.oc_block != 0)) {
+        // The padded bias is copied to diff_bias at the end, so it has to
+        // start from the values being accumulated into.
+        auto padded_bias = scratchpad.template get<float>(key_conv_padded_bias);
+        auto diff_bias = CTX_OUT_MEM(const float *, DNNL_ARG_DIFF_BIAS);
+        const int padded_stride = rnd_up(jcp.oc, jcp.oc_block);
+        for (int g = 0; g < jcp.ngroups; ++g)
+            utils::array_copy(padded_bias + g * padded_stride,
+                    diff_bias + g * jcp.oc, jcp.oc);
+    }
 }
 
 void brgemm_convolution_bwd_weights_t::execute_backward_weights(
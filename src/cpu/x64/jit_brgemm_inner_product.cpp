@@ -1387,6 +1387,11 @@ void brgemm_inner_product_bwd_weights_t<isa>::compute_diff_weights_and_bias(
     char *wsp_tile_global = (is_amx_bf16) ? ti->wsp_tile_base : nullptr;
     int os_chunks = utils::div_up(jbgp.nb_os, jbgp.nb_os_blocking);
 
+    // With accumulation the threads of the first os chunk group add to
+    // diff_weights and diff_bias directly, so they do not initialize them.
+    const bool accumulate_in_place
+            = pd()->with_accumulation() && ti->ithr_os_c == 0;
+
     const auto get_bia_acc_ptr = [&](int oc) {
         const int reduction_buf_start_idx = jbgp.bia_dt == f32;
         if (jbgp.bia_dt != data_type::f32
@@ -1422,7 +1427,7 @@ void brgemm_inner_product_bwd_weights_t<isa>::compute_diff_weights_and_bias(
         char *a_buffer = ti->get_buffer_a_ptr(icb, osc);
         char *b_buffer = ti->get_buffer_b_ptr(ocb, osc);
 
-        bool kernel_init = (osc == ti->os_c_start);
+        bool kernel_init = (osc == ti->os_c_start) && !accumulate_in_place;
 
         bool is_os_tail = jbgp.mb - n < jbgp.os_block * jbgp.nb_os_blocking;
         bool is_ic_tail = jbgp.ic - ic < jbgp.ic_block;
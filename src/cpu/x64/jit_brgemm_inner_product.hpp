@@ -409,7 +409,12 @@ struct brgemm_inner_product_bwd_weights_t : public primitive_t {
                     && diff_dst_type == src_dt
                     && utils::one_of(diff_wei_type, data_type::f32, src_dt)
                     && attr()->has_default_values(
-                            primitive_attr_t::skip_mask_t::post_ops);
+                            primitive_attr_t::skip_mask_t::post_ops)
+                    && IMPLICATION(with_accumulation(),
+                            diff_wei_type == data_type::f32
+                                    && IMPLICATION(with_bias(),
+                                            invariant_bia_md()->data_type
+                                                    == data_type::f32));
             if (!ok) return status::unimplemented;
 
             CHECK(jbgp_.init_conf(isa, *desc(), src_md_, diff_weights_md_,
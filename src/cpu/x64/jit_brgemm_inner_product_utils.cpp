@@ -33,6 +33,9 @@ using namespace data_type;
 
 namespace brgemm_inner_product_utils {
 
+// The largest os (batch size) handled as a matrix-vector product.
+static constexpr int max_tiny_os = 8;
+
 // Returns amount of work on a thread when using parallel reduction.
 static int comp_work(
         int nthrs, int nthr_k, int n_chunks, int n_reduction_blocks) {
@@ -139,7 +142,8 @@ int jit_brgemm_ip_conf_t::get_os_block(
     if (os_block < min_os_block) os_block = nstl::min(jbgp.os, max_os_block);
 
     // Use large os-block to reduce bandwidth requirement.
-    if (jbgp.use_small_os_kernels) os_block = jbgp.os;
+    if (jbgp.use_small_os_kernels || jbgp.use_tiny_os_kernels)
+        os_block = jbgp.os;
 
     return os_block;
 }
@@ -269,6 +273,17 @@ int jit_brgemm_ip_conf_t::get_oc_block(bool try_to_adjust) const {
         // os-direction.
         if (jbgp.use_small_os_kernels) oc_block = 2 * jbgp.simd_w;
 
+        // For tiny os the problem is a matrix-vector product bound by the
+        // weights bandwidth. The block is limited so that accumulators for all
+        // os rows fit into registers. It depends on os only, so the weights
+        // layout does not change with the number of threads.
+        if (jbgp.use_tiny_os_kernels) {
+            const int max_tiny_block = nstl::max(1,
+                    nstl::min(max_block,
+                            (isa_num_vregs(jbgp.isa) - 1) / (jbgp.os + 1)));
+            oc_block = nstl::min(oc_block, max_tiny_block * jbgp.simd_w);
+        }
+
         return oc_block;
     }
 }
@@ -354,7 +369,8 @@ int jit_brgemm_ip_conf_t::get_adjusted_oc_block() const {
     if (adjust_thread_balance()) {
         if (is_f32_compute_avx512) {
             int n = oc_block / jbgp.simd_w;
-            bool do_adjust = n > 1 && !jbgp.use_small_os_kernels;
+            bool do_adjust = n > 1 && !jbgp.use_small_os_kernels
+                    && !jbgp.use_tiny_os_kernels;
             oc_block = do_adjust ? (n - 1) * jbgp.simd_w : oc_block;
         } else {
             oc_block = (oc_block > 16) ? oc_block / 2 : oc_block;
@@ -622,7 +638,7 @@ status_t jit_brgemm_ip_fwd_conf_t::init_conf(cpu_isa_t isa,
     const bool is_avx512 = is_superset(jbgp.isa, avx512_core);
     const int min_os_block = 6;
     while (!balanced && jbgp.os_block > min_os_block && is_f32_compute
-            && is_avx512) {
+            && is_avx512 && !jbgp.use_tiny_os_kernels) {
         int max_os_block = jbgp.os_block - 1;
         jbgp.os_block = max_div(jbgp.os, max_os_block);
         jbgp.os_block = nstl::max(jbgp.os_block, min_os_block);
@@ -673,6 +689,8 @@ status_t jit_brgemm_ip_fwd_conf_t::init_conf(cpu_isa_t isa,
 
     // TODO: Consider expanding to other arches and data types.
     use_min_os_block &= is_f32_compute && is_avx512;
+    // Tiny os is always computed by a single kernel call.
+    use_min_os_block &= !jbgp.use_tiny_os_kernels;
 
     if (use_min_os_block) {
         // Get potential bd_block from main kernel.
@@ -1411,8 +1429,11 @@ status_t jit_brgemm_ip_conf_t::init_conf_base(cpu_isa_t isa,
 
     // If os is tiny, less than # registers for broadcast in kernel, we only
     // read the weights once in the kernel.
-    small_os &= jbgp.os > 6;
+    const bool tiny_os = jbgp.os <= max_tiny_os;
+    small_os &= !tiny_os;
     jbgp.use_small_os_kernels = is_f32 && small_os && jbgp.oc % 32 == 0;
+    jbgp.use_tiny_os_kernels = is_f32 && tiny_os
+            && one_of(jbgp.prop_kind, forward_training, forward_inference);
 
     jbgp.use_uker = true;
     jbgp.use_interleave_stores = jbgp.use_uker;
@@ -47,6 +47,9 @@ namespace brgemm_inner_product_utils {
 struct jit_brgemm_ip_conf_t : jit_brgemm_primitive_conf_t {
     // Use kernels and blocking for small os that consume less bandwidth.
     bool use_small_os_kernels = false;
+    // Use blocking for tiny os (batch size) that keeps the whole os in a
+    // single kernel call and the oc-block within the register budget of os.
+    bool use_tiny_os_kernels = false;
 
 protected:
     status_t init_conf_base(cpu_isa_t isa, const inner_product_desc_t &ipd,
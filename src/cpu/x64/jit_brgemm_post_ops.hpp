@@ -382,6 +382,15 @@ struct jit_brgemm_kernel_post_ops : public jit_generator {
             static constexpr bool preserve_vmm = true;
             static constexpr bool use_exact_tail_scalar_bcast = false;
 
+            static const bcast_set_t enabled_bcast_strategy
+                    = {broadcasting_strategy_t::scalar,
+                            broadcasting_strategy_t::per_oc,
+                            broadcasting_strategy_t::per_oc_spatial,
+                            broadcasting_strategy_t::per_mb_spatial,
+                            broadcasting_strategy_t::per_mb_w,
+                            broadcasting_strategy_t::per_w,
+                            broadcasting_strategy_t::no_broadcast,
+                            broadcasting_strategy_t::no_broadcast_strided};
             const binary_injector::rhs_arg_static_params_t rhs_sp {
                     static_cast<size_t>(vmm_tmp(4).getIdx()), this->r14,
                     this->r15, this->r13, preserve_gpr, preserve_vmm,
@@ -389,7 +398,8 @@ struct jit_brgemm_kernel_post_ops : public jit_generator {
                     memory_desc_wrapper(brg.dst_md),
                     static_cast<size_t>(brg.load_dim % brg.ld_block),
                     k_tail_mask, use_exact_tail_scalar_bcast};
-            const binary_injector::static_params_t bsp {this->param1, rhs_sp};
+            const binary_injector::static_params_t bsp {
+                    this->param1, enabled_bcast_strategy, rhs_sp};
 
             const bool save_state = jcp.with_eltwise;
             const auto &reserved_eltwise_gpr = reg_reserved_eltwise;
@@ -302,6 +302,29 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
     auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
 
+    parallel(0, [&](const int ithr, const int nthr) {
+        execute_thr(src, dst, ithr, nthr);
+    });
+
+    return status::success;
+}
+
+template <cpu_isa_t isa, data_type_t d_type>
+status_t jit_uni_eltwise_fwd_t<isa, d_type>::get_team_task(
+        const exec_ctx_t &ctx, team_task_t &task) const {
+    auto src = CTX_IN_MEM(const data_t *, DNNL_ARG_SRC);
+    auto dst = CTX_OUT_MEM(data_t *, DNNL_ARG_DST);
+
+    task = [=](const int ithr, const int nthr) {
+        execute_thr(src, dst, ithr, nthr);
+    };
+
+    return status::success;
+}
+
+template <cpu_isa_t isa, data_type_t d_type>
+void jit_uni_eltwise_fwd_t<isa, d_type>::execute_thr(
+        const data_t *src, data_t *dst, int ithr, int nthr) const {
     const memory_desc_wrapper data_d(pd()->src_md());
     const auto nelems = data_d.nelems(true);
     const int simd_w = 64 / data_d.data_type_size();
@@ -309,23 +332,19 @@ status_t jit_uni_eltwise_fwd_t<isa, d_type>::execute(
     src += data_d.offset0();
     dst += data_d.offset0();
 
-    parallel(0, [&](const int ithr, const int nthr) {
-        dim_t start {0}, end {0};
-
-        balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
-        start = nstl::min(nelems, start * simd_w);
-        end = nstl::min(nelems, end * simd_w);
-        if (start == end) return;
+    dim_t start {0}, end {0};
 
-        jit_args_t args;
-        args.src = src + start;
-        args.dst = dst + start;
-        args.diff_dst = nullptr;
-        args.work_amount = end - start;
-        (*kernel_)(&args);
-    });
+    balance211(utils::div_up(nelems, simd_w), nthr, ithr, start, end);
+    start = nstl::min(nelems, start * simd_w);
+    end = nstl::min(nelems, end * simd_w);
+    if (start == end) return;
 
-    return status::success;
+    jit_args_t args;
+    args.src = src + start;
+    args.dst = dst + start;
+    args.diff_dst = nullptr;
+    args.work_amount = end - start;
+    (*kernel_)(&args);
 }
 
 template <cpu_isa_t isa, data_type_t d_type>
@@ -59,9 +59,15 @@ struct jit_uni_eltwise_fwd_t : public primitive_t {
     status_t init(engine_t *engine) override;
 
     status_t execute(const exec_ctx_t &ctx) const override;
+    status_t get_team_task(
+            const exec_ctx_t &ctx, team_task_t &task) const override;
 
 private:
     const pd_t *pd() const { return (const pd_t *)primitive_t::pd().get(); }
+    // Runs the share of thread `ithr` out of `nthr`, used by both execute()
+    // and the team task.
+    void execute_thr(
+            const data_t *src, data_t *dst, int ithr, int nthr) const;
     std::unique_ptr<jit_uni_eltwise_kernel> kernel_;
 };
 
@@ -14,8 +14,10 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include "common/bfloat16.hpp"
 #include "common/c_types_map.hpp"
 #include "common/dnnl_thread.hpp"
+#include "common/float16.hpp"
 #include "common/memory_tracking.hpp"
 #include "common/tag_traits.hpp"
 #include "common/type_helpers.hpp"
@@ -23,6 +25,7 @@
 
 #include "cpu/cpu_primitive.hpp"
 #include "cpu/matmul/matmul_utils.hpp"
+#include "cpu/ref_io_helper.hpp"
 #include "cpu/scale_utils.hpp"
 
 #include "cpu/x64/amx_tile_configure.hpp"
@@ -50,13 +53,19 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
     const auto wei_dt = weights_md_.data_type;
     const auto dst_dt = dst_md_.data_type;
 
-    const bool is_f32 = everyone_is(f32, src_dt, wei_dt, dst_dt);
+    // Integer weights are decompressed to the source data type, so the
+    // problem is computed as a floating point one.
+    const bool is_wei_decomp = attr()->fpmath_apply_to_int_
+            && one_of(wei_dt, s8, u8) && one_of(src_dt, f32, bf16, f16);
+    const auto comp_wei_dt = is_wei_decomp ? src_dt : wei_dt;
+
+    const bool is_f32 = everyone_is(f32, src_dt, comp_wei_dt, dst_dt);
     const bool is_int8 = one_of(src_dt, u8, s8) && wei_dt == s8
             && one_of(dst_dt, u8, s8, s32, f32, bf16);
-    const bool is_bf16
-            = everyone_is(bf16, src_dt, wei_dt) && one_of(dst_dt, bf16, f32);
-    const bool is_f16
-            = everyone_is(f16, src_dt, wei_dt) && one_of(dst_dt, f16, f32);
+    const bool is_bf16 = everyone_is(bf16, src_dt, comp_wei_dt)
+            && one_of(dst_dt, bf16, f32);
+    const bool is_f16 = everyone_is(f16, src_dt, comp_wei_dt)
+            && one_of(dst_dt, f16, f32);
 
     auto check_bias = [&]() -> bool {
         const auto bia_dt = weights_md(1)->data_type;
@@ -82,8 +91,37 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
         return ok;
     };
 
-    auto check_attr_zero_points
-            = [&]() -> bool { return attr()->zero_points_.common(); };
+    auto check_attr_zero_points = [&]() -> bool {
+        // Decompression supports weights zero points only, their mask is
+        // checked in init_brgemm_matmul_conf().
+        if (is_wei_decomp)
+            return attr()->zero_points_.has_default_values(DNNL_ARG_SRC)
+                    && attr()->zero_points_.has_default_values(DNNL_ARG_DST);
+        return attr()->zero_points_.common();
+    };
+
+    // Output selection is supported for 2D floating point problems with plain
+    // weights only. Selected weights columns are gathered into a dense buffer
+    // of the same layout, so per-N quantities must follow dst columns.
+    auto check_output_select = [&]() -> bool {
+        if (!with_output_select()) return true;
+        return ndims() == 2 && !is_int8
+                && attr()->scales_.get(DNNL_ARG_WEIGHTS).mask_ == 0
+                && memory_desc_matches_one_of_tag(
+                           weights_md_, format_tag::ab, format_tag::ba)
+                != format_tag::undef;
+    };
+
+    // A gated activation is supported as the only post-op for plain
+    // destination without dst scales and zero points. Both halves of the
+    // weights are computed into an f32 accumulator and gated afterwards.
+    auto check_glu = [&]() -> bool {
+        if (!with_glu()) return true;
+        return attr()->post_ops_.len() == 1
+                && attr()->scales_.get(DNNL_ARG_DST).has_default_values()
+                && attr()->zero_points_.has_default_values(DNNL_ARG_DST)
+                && !has_runtime_dims_or_strides();
+    };
 
     // The current version supports runtime value for M dimension in the case
     // of 2d problems only and do not support any runtime strides for B and C
@@ -104,17 +142,47 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
                     primitive_attr_t::skip_mask_t::scales_runtime
                             | primitive_attr_t::skip_mask_t::zero_points_runtime
                             | primitive_attr_t::skip_mask_t::post_ops
-                            | primitive_attr_t::skip_mask_t::sum_dt,
+                            | primitive_attr_t::skip_mask_t::sum_dt
+                            | primitive_attr_t::skip_mask_t::output_select,
                     dst_dt),
             VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(check_output_select(), VERBOSE_UNSUPPORTED_ATTR);
+    VDISPATCH_MATMUL(check_glu(), VERBOSE_UNSUPPORTED_POSTOP);
     VDISPATCH_MATMUL(attr()->post_ops_.check_sum_consistency(dst_dt, is_int8),
             VERBOSE_UNSUPPORTED_DT);
     VDISPATCH_MATMUL(check_attr_scales(), VERBOSE_UNSUPPORTED_SCALES_CFG);
     VDISPATCH_MATMUL(check_attr_zero_points(), VERBOSE_UNSUPPORTED_ZP_CFG);
     VDISPATCH_MATMUL(check_bias(), VERBOSE_UNSUPPORTED_BIAS_CFG);
 
-    CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_, weights_md_,
-            dst_md_, bias_md_, attr_));
+    wei_gather_md_ = weights_md_;
+    if (with_output_select()) {
+        const dims_t wei_gather_dims = {K(), N()};
+        CHECK(memory_desc_init_by_tag(wei_gather_md_, ndims(), wei_gather_dims,
+                wei_dt,
+                memory_desc_matches_one_of_tag(
+                        weights_md_, format_tag::ab, format_tag::ba)));
+    }
+    if (with_glu()) {
+        if (dst_md_.format_kind == format_kind::any)
+            CHECK(memory_desc_init_by_strides(dst_md_, nullptr));
+        memory_desc_t plain_dst_md = dst_md_;
+        CHECK(memory_desc_init_by_strides(plain_dst_md, nullptr));
+        VDISPATCH_MATMUL(dst_md_ == plain_dst_md, VERBOSE_UNSUPPORTED_TAG);
+
+        dims_t acc_dims;
+        utils::array_copy(acc_dims, dst_md_.dims, ndims());
+        acc_dims[ndims() - 1] = gemm_N();
+        CHECK(memory_desc_init_by_strides(
+                glu_acc_md_, ndims(), acc_dims, f32, nullptr));
+        CHECK(glu_attr_.copy_from(attr_));
+        glu_attr_.post_ops_ = post_ops_t();
+    }
+    // Kernels compute the destination the primitive is configured for.
+    auto &gemm_dst_md = with_glu() ? glu_acc_md_ : dst_md_;
+    auto &gemm_attr = with_glu() ? glu_attr_ : attr_;
+    CHECK(init_brgemm_matmul_conf(isa, bgmmc_, *desc(), src_md_,
+            with_output_select() ? wei_gather_md_ : weights_md_, gemm_dst_md,
+            bias_md_, gemm_attr));
 
     const float alpha = 1.0;
     const float beta = 1.0;
@@ -158,7 +226,7 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
         auto LDD = bgmmc_.LDD;
         CHECK(brgemm_desc_set_postops(
-                &brg, attr(), &dst_md_, LDD, bgmmc_.bia_dt));
+                &brg, &gemm_attr, &gemm_dst_md, LDD, bgmmc_.bia_dt));
 
         brgemm_attr_t brgattr;
         brgattr.generate_skip_accumulation
@@ -184,7 +252,13 @@ status_t brgemm_matmul_t<isa>::pd_t::init(engine_t *engine) {
 
     auto scratchpad = scratchpad_registry().registrar();
     init_scratchpad(scratchpad, bgmmc_);
-    book_precomputed_scales(scratchpad, attr()->scales_, N());
+    book_precomputed_scales(scratchpad, attr()->scales_, gemm_N());
+    if (with_output_select())
+        scratchpad.book(key_matmul_wei_gather,
+                memory_desc_wrapper(wei_gather_md_).size(), 1);
+    if (with_glu())
+        scratchpad.book(key_matmul_glu_acc,
+                memory_desc_wrapper(glu_acc_md_).size(), 1);
 
     return status::success;
 }
@@ -209,7 +283,8 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
             brgemm_palettes_.insert(idx, pd()->get_brg_desc(idx));
     }
 
-    if (bgmmc.use_buffer_b)
+    // Decompressed weights are copied by decompress_b_chunk().
+    if (bgmmc.use_buffer_b && !bgmmc.is_wei_decomp)
         CHECK(create_brgemm_matmul_copy_b(copy_B_kernel_, &bgmmc));
 
     if (bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only)
@@ -225,13 +300,33 @@ status_t brgemm_matmul_t<isa>::init(engine_t *engine) {
         CHECK(acc_ker_s32_->create_kernel());
     }
 
+    if (pd()->with_glu()) {
+        const auto &po = pd()->attr()->post_ops_;
+        CHECK(safe_ptr_assign(glu_eltwise_,
+                new ref_eltwise_scalar_fwd_t(
+                        po.entry_[po.find(primitive_kind::glu)].glu)));
+    }
+
     return status::success;
 }
 
 template <cpu_isa_t isa>
 status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
+    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
+
     DEFINE_ZERO_POINT_VALUE(src_zero_point, DNNL_ARG_SRC);
-    DEFINE_ZERO_POINT_VALUE(wei_zero_point, DNNL_ARG_WEIGHTS);
+    // Zero points of decompressed weights may be per N, they are applied
+    // while copying B.
+    int32_t wei_zero_point = 0;
+    if (!bgmmc.is_wei_decomp) {
+        DEFINE_ZERO_POINT_VALUE(wei_zp, DNNL_ARG_WEIGHTS);
+        wei_zero_point = wei_zp;
+    } else if (bgmmc.wei_decomp_zp_type != brgemm_broadcast_t::none
+            && CTX_IN_MEM(const int32_t *,
+                       DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS)
+                    == nullptr) {
+        return status::invalid_arguments;
+    }
     DEFINE_ZERO_POINT_VALUE(dst_zero_point, DNNL_ARG_DST);
     DEFINE_ARG_SCALES_BUFFER(src_scales, DNNL_ARG_SRC);
     DEFINE_ARG_SCALES_BUFFER(wei_scales, DNNL_ARG_WEIGHTS);
@@ -242,14 +337,15 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
     const auto dst_d = ctx.memory_mdw(DNNL_ARG_DST, pd()->dst_md());
     matmul_helper_t helper(src_d, weights_d, dst_d);
 
+    if (pd()->with_output_select()) CHECK(gather_selected_weights(ctx));
+
     auto &scratchpad = ctx.get_scratchpad_grantor();
     const float *oscales = precompute_scales(
-            scratchpad, src_scales, wei_scales, pd()->N(), pd()->attr());
+            scratchpad, src_scales, wei_scales, pd()->gemm_N(), pd()->attr());
 
     brg_matmul_exec_ctx_t brgmm_ctx(ctx, pd(), oscales, src_zero_point,
             wei_zero_point, dst_zero_point, dst_scales, helper);
 
-    const auto &bgmmc = pd()->get_brgemm_matmul_conf();
     const bool use_buffer_a
             = bgmmc.use_buffer_a || bgmmc.use_buffer_a_tail_only;
     const bool is_amx = is_superset(isa, avx512_core_amx);
@@ -319,6 +415,72 @@ status_t brgemm_matmul_t<isa>::execute_body(const exec_ctx_t &ctx) const {
 
     maybe_reduce_partial_results_and_apply_postops(brgmm_ctx);
 
+    if (pd()->with_glu()) apply_glu(ctx);
+
+    return status::success;
+}
+
+template <cpu_isa_t isa>
+void brgemm_matmul_t<isa>::apply_glu(const exec_ctx_t &ctx) const {
+    const float *acc = ctx.get_scratchpad_grantor().template get<const float>(
+            key_matmul_glu_acc);
+    auto dst = CTX_OUT_MEM(void *, DNNL_ARG_DST);
+    const auto dst_dt = pd()->dst_md()->data_type;
+    const dim_t N = pd()->N();
+    const dim_t rows = pd()->batch() * pd()->M();
+
+    // Both the accumulator and the destination are plain, so a row of the
+    // destination is gated from the matching row of the accumulator.
+    parallel_nd(rows, [&](dim_t r) {
+        const float *acc_row = acc + r * 2 * N;
+        for (dim_t n = 0; n < N; n++) {
+            const float gate = glu_eltwise_->compute_scalar(acc_row[n]);
+            io::store_float_value(
+                    dst_dt, gate * acc_row[N + n], dst, r * N + n);
+        }
+    });
+}
+
+template <cpu_isa_t isa>
+status_t brgemm_matmul_t<isa>::gather_selected_weights(
+        const exec_ctx_t &ctx) const {
+    const auto weights = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+    const auto output_select
+            = CTX_IN_MEM(const int32_t *, DNNL_ARG_ATTR_OUTPUT_SELECT);
+    if (output_select == nullptr) return status::invalid_arguments;
+    char *wei_gather = ctx.get_scratchpad_grantor().template get<char>(
+            key_matmul_wei_gather);
+
+    const memory_desc_wrapper weights_d(pd()->weights_md());
+    const memory_desc_wrapper wei_gather_d(pd()->wei_gather_md());
+    const dim_t K = pd()->K();
+    const dim_t N = pd()->N();
+    const dim_t dt_sz = weights_d.data_type_size();
+    const dim_t wei_k_str = weights_d.blocking_desc().strides[0];
+    const dim_t wei_n_str = weights_d.blocking_desc().strides[1];
+
+    const dim_t wei_N = weights_d.dims()[1];
+    for (dim_t n = 0; n < N; n++)
+        if (output_select[n] < 0 || output_select[n] >= wei_N)
+            return status::invalid_arguments;
+
+    if (wei_n_str != 1) {
+        // Columns are contiguous in `ba` layout: copy each selected one.
+        parallel_nd(N, [&](dim_t n) {
+            std::memcpy(wei_gather + wei_gather_d.off(0, n) * dt_sz,
+                    weights + output_select[n] * wei_n_str * dt_sz,
+                    K * dt_sz);
+        });
+    } else {
+        parallel_nd(K, [&](dim_t k) {
+            const char *wei_row = weights + k * wei_k_str * dt_sz;
+            char *gather_row = wei_gather + wei_gather_d.off(k, 0) * dt_sz;
+            for (dim_t n = 0; n < N; n++)
+                std::memcpy(gather_row + n * dt_sz,
+                        wei_row + output_select[n] * dt_sz, dt_sz);
+        });
+    }
+
     return status::success;
 }
 
@@ -650,6 +812,74 @@ void brgemm_matmul_t<isa>::copy_a_chunk_in_buffer(
     }
 }
 
+namespace {
+// Decompresses a K_iters x N_blk block of integer weights into the B buffer,
+// using the layout brgemm kernels expect for `out_t`: rows of LDB elements
+// interleaved by vnni granularity. Tails up to LDB and to the vnni
+// granularity are zero padded.
+template <typename in_t, typename out_t>
+void decompress_b_block(out_t *tr_src, const in_t *src, dim_t src_k_stride,
+        dim_t src_n_stride, int K_iters, int N_blk, dim_t LDB, int vnni,
+        const int32_t *zp, dim_t zp_n_stride) {
+    const int K_padded = rnd_up(K_iters, vnni);
+    for (int k = 0; k < K_padded; k++) {
+        out_t *tr_row = tr_src + (k / vnni) * LDB * vnni + k % vnni;
+        int n = 0;
+        if (k < K_iters) {
+            const in_t *src_row = src + k * src_k_stride;
+            for (; n < N_blk; n++) {
+                const float zp_val
+                        = zp ? static_cast<float>(zp[n * zp_n_stride]) : 0.f;
+                const float wei_val
+                        = static_cast<float>(src_row[n * src_n_stride]);
+                tr_row[n * vnni] = wei_val - zp_val;
+            }
+        }
+        for (; n < LDB; n++)
+            tr_row[n * vnni] = 0.f;
+    }
+}
+
+template <typename in_t>
+void decompress_b_block_typed(const brgemm_matmul_conf_t &bgmmc,
+        void *tr_src, const in_t *src, int K_iters, int N_blk,
+        const int32_t *zp) {
+    const dim_t src_k_stride = bgmmc.B_strides[1] / bgmmc.b_dt_sz;
+    const dim_t src_n_stride = bgmmc.B_strides[0] / bgmmc.b_dt_sz;
+    const int vnni = data_type_vnni_granularity(bgmmc.wei_dt);
+    const dim_t zp_n_stride
+            = bgmmc.wei_decomp_zp_type == brgemm_broadcast_t::per_n ? 1 : 0;
+    switch (bgmmc.wei_dt) {
+        case f32:
+            decompress_b_block((float *)tr_src, src, src_k_stride,
+                    src_n_stride, K_iters, N_blk, bgmmc.LDB, vnni, zp,
+                    zp_n_stride);
+            break;
+        case bf16:
+            decompress_b_block((bfloat16_t *)tr_src, src, src_k_stride,
+                    src_n_stride, K_iters, N_blk, bgmmc.LDB, vnni, zp,
+                    zp_n_stride);
+            break;
+        case f16:
+            decompress_b_block((float16_t *)tr_src, src, src_k_stride,
+                    src_n_stride, K_iters, N_blk, bgmmc.LDB, vnni, zp,
+                    zp_n_stride);
+            break;
+        default: assert(!"unsupported decompression data type");
+    }
+}
+
+void decompress_b_block(const brgemm_matmul_conf_t &bgmmc, void *tr_src,
+        const void *src, int K_iters, int N_blk, const int32_t *zp) {
+    if (bgmmc.orig_wei_dt == s8)
+        decompress_b_block_typed(
+                bgmmc, tr_src, (const int8_t *)src, K_iters, N_blk, zp);
+    else
+        decompress_b_block_typed(
+                bgmmc, tr_src, (const uint8_t *)src, K_iters, N_blk, zp);
+}
+} // namespace
+
 template <cpu_isa_t isa>
 void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
         const brg_matmul_exec_ctx_t &brgmm_ctx, int ithr, int b_idx,
@@ -678,7 +908,11 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
                 = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
         ctx.current_K_start = k;
         ctx.current_K_iters = nstl::min(bgmmc.K_blk, bgmmc.K);
-        if (bgmmc.blocked_B && isa == avx512_core_fp16) {
+        if (bgmmc.is_wei_decomp) {
+            decompress_b_block(bgmmc, (void *)ctx.tr_src, ctx.src,
+                    ctx.current_K_iters, ctx.current_N_blk,
+                    brgmm_ctx.get_wei_decomp_zp_ptr(n));
+        } else if (bgmmc.blocked_B && isa == avx512_core_fp16) {
             cvt_float16_to_float((float *)ctx.tr_src, (float16_t *)ctx.src,
                     bgmmc.wei_n_blk * ctx.current_K_iters);
         } else {
@@ -694,7 +928,11 @@ void brgemm_matmul_t<isa>::copy_b_chunk_in_buffer(
                 = (void *)brgmm_ctx.get_s8s8_comp_ptr(ithr, b_idx, n_blk_idx);
         ctx.current_K_start = k;
         ctx.current_K_iters = bgmmc.K % bgmmc.K_blk;
-        if (bgmmc.blocked_B && isa == avx512_core_fp16) {
+        if (bgmmc.is_wei_decomp) {
+            decompress_b_block(bgmmc, (void *)ctx.tr_src, ctx.src,
+                    ctx.current_K_iters, ctx.current_N_blk,
+                    brgmm_ctx.get_wei_decomp_zp_ptr(n));
+        } else if (bgmmc.blocked_B && isa == avx512_core_fp16) {
             cvt_float16_to_float((float *)ctx.tr_src, (float16_t *)ctx.src,
                     bgmmc.wei_n_blk * ctx.current_K_iters);
         } else {
@@ -724,8 +962,14 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         : bgmmc_(pd->get_brgemm_matmul_conf()) {
 
         data_A_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_SRC);
-        data_B_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
-        data_C_ptr_ = CTX_OUT_MEM(char *, DNNL_ARG_DST);
+        data_B_ptr_ = pd->with_output_select()
+                ? ctx.get_scratchpad_grantor().template get<const char>(
+                        key_matmul_wei_gather)
+                : CTX_IN_MEM(const char *, DNNL_ARG_WEIGHTS);
+        data_C_ptr_ = pd->with_glu()
+                ? ctx.get_scratchpad_grantor().template get<char>(
+                        key_matmul_glu_acc)
+                : CTX_OUT_MEM(char *, DNNL_ARG_DST);
 
         bias_ptr_ = CTX_IN_MEM(const char *, DNNL_ARG_BIAS);
         oscales_ptr_ = oscales;
@@ -790,6 +1034,13 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
 
         zero_point_c_val_ = dst_zp;
 
+        const bool with_wei_decomp_zp
+                = bgmmc.wei_decomp_zp_type != brgemm_broadcast_t::none;
+        wei_decomp_zp_ptr_ = with_wei_decomp_zp
+                ? CTX_IN_MEM(const int32_t *,
+                        DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS)
+                : nullptr;
+
         post_ops_binary_rhs_arg_vec_ = binary_injector::prepare_binary_args(
                 pd->attr()->post_ops_, ctx);
         base_brg_ker_idx_
@@ -1200,6 +1451,14 @@ struct brgemm_matmul_t<isa>::brg_matmul_exec_ctx_t {
         return &zero_point_a_negative_val_;
     }
 
+    // Returns weights zero points for decompression of the weights column n.
+    const int32_t *get_wei_decomp_zp_ptr(int n) const {
+        if (wei_decomp_zp_ptr_ == nullptr) return nullptr;
+        return bgmmc_.wei_decomp_zp_type == brgemm_broadcast_t::per_n
+                ? wei_decomp_zp_ptr_ + n
+                : wei_decomp_zp_ptr_;
+    }
+
     const int32_t *get_zp_b_neg_val_ptr() const {
         return &zero_point_b_negative_val_;
     }
@@ -1457,6 +1716,7 @@ private:
     int32_t zero_point_b_negative_val_;
     int32_t zero_point_mixed_ab_compensation_component_;
     int32_t zero_point_c_val_;
+    const int32_t *wei_decomp_zp_ptr_;
     std::vector<const void *> post_ops_binary_rhs_arg_vec_;
 
     int base_brg_ker_idx_;
@@ -22,6 +22,7 @@
 #include "common/type_helpers.hpp"
 
 #include "cpu/matmul/cpu_matmul_pd.hpp"
+#include "cpu/primitive_attr_postops.hpp"
 
 #include "cpu/x64/brgemm/brgemm.hpp"
 #include "cpu/x64/brgemm/brgemm_containers.hpp"
@@ -95,9 +96,21 @@ struct brgemm_matmul_t : public primitive_t {
             return bgmmc_;
         }
 
+        const memory_desc_t *wei_gather_md() const { return &wei_gather_md_; }
+        // Number of weights columns computed by the kernels.
+        dim_t gemm_N() const { return with_glu() ? 2 * N() : N(); }
+
     private:
         brgemm_t brg_descs_[max_num_brg_kernels_matmul];
         brgemm_matmul_conf_t bgmmc_;
+        // Weights with only the selected columns when output selection is
+        // used, the kernels are configured for this descriptor.
+        memory_desc_t wei_gather_md_;
+        // Accumulator for both halves of the weights when a gated activation
+        // is used, the kernels are configured for this descriptor and for
+        // the attributes without the gating post-op.
+        memory_desc_t glu_acc_md_;
+        primitive_attr_t glu_attr_;
     };
 
     brgemm_matmul_t(const pd_t *apd) : primitive_t(apd) {}
@@ -121,6 +134,8 @@ private:
             int ithr, int b_idx, int m_blk_idx, int k_blk_idx) const;
     void copy_b_chunk_in_buffer(const brg_matmul_exec_ctx_t &brgmm_ctx,
             int ithr, int b_idx, int n_blk_idx, int k_blk_idx) const;
+    status_t gather_selected_weights(const exec_ctx_t &ctx) const;
+    void apply_glu(const exec_ctx_t &ctx) const;
     void maybe_reduce_partial_results_and_apply_postops(
             const brg_matmul_exec_ctx_t &brgmm_ctx) const;
     void accumulate(
@@ -134,6 +149,7 @@ private:
     std::unique_ptr<jit_brgemm_matmul_copy_a_t> copy_A_kernel_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::f32>> acc_ker_f32_;
     std::unique_ptr<cpu_accumulator_1d_t<data_type::s32>> acc_ker_s32_;
+    std::unique_ptr<ref_eltwise_scalar_fwd_t> glu_eltwise_;
 };
 
 } // namespace matmul
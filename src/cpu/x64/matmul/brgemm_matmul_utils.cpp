@@ -125,7 +125,8 @@ bool post_ops_ok(brgemm_matmul_conf_t &bgmmc, const primitive_attr_t &attr,
             broadcasting_strategy_t::scalar,
             broadcasting_strategy_t::per_mb_spatial,
             broadcasting_strategy_t::per_mb_w, broadcasting_strategy_t::per_w,
-            broadcasting_strategy_t::no_broadcast};
+            broadcasting_strategy_t::no_broadcast,
+            broadcasting_strategy_t::no_broadcast_strided};
     const bcast_set_t limited_bcast_set = {broadcasting_strategy_t::scalar,
             broadcasting_strategy_t::no_broadcast};
     const bcast_set_t bcast_set = limit_bcast_strategies_set
@@ -185,9 +186,10 @@ brgemm_matmul_conf_utils_t::brgemm_matmul_conf_utils_t(
     , blocked_48n_B_layout_tag(pick_blocked_B_layout(48))
     , blocked_32n_B_layout_tag(pick_blocked_B_layout(32))
     , blocked_16n_B_layout_tag(pick_blocked_B_layout(16))
-    , blocked_B_layouts_allowed(!utils::one_of(format_tag::undef,
-              blocked_64n_B_layout_tag, blocked_48n_B_layout_tag,
-              blocked_32n_B_layout_tag, blocked_16n_B_layout_tag))
+    , blocked_B_layouts_allowed(!bgmmc.is_wei_decomp
+              && !utils::one_of(format_tag::undef, blocked_64n_B_layout_tag,
+                      blocked_48n_B_layout_tag, blocked_32n_B_layout_tag,
+                      blocked_16n_B_layout_tag))
     , n_blk_fixed((!B_any_layout) && blocked_B_layouts_allowed)
     , isa_(isa) {
     assert(int8_dt || bf16_dt || f16_dt || f32_dt || bf32_dt);
@@ -948,6 +950,15 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.src_dt = src_d.data_type();
     bgmmc.dst_dt = dst_d.data_type();
     bgmmc.wei_dt = weights_d.data_type();
+    bgmmc.orig_wei_dt = bgmmc.wei_dt;
+
+    // Integer weights with floating point activations are decompressed to
+    // the source data type, so the problem is computed as a floating point
+    // one.
+    bgmmc.is_wei_decomp = attr.fpmath_apply_to_int_
+            && one_of(bgmmc.wei_dt, s8, u8)
+            && one_of(bgmmc.src_dt, f32, bf16, f16);
+    if (bgmmc.is_wei_decomp) bgmmc.wei_dt = bgmmc.src_dt;
 
     bgmmc.with_bias = mmd.bias_desc.format_kind != format_kind::undef;
     bgmmc.bia_dt = bgmmc.with_bias ? mmd.bias_desc.data_type : data_type::undef;
@@ -966,6 +977,8 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.is_amx = is_superset(isa, avx512_core_amx);
     bgmmc.a_dt_sz = bgmmc.tr_a_dt_sz = types::data_type_size(bgmmc.src_dt);
     bgmmc.b_dt_sz = bgmmc.tr_b_dt_sz = types::data_type_size(bgmmc.wei_dt);
+    if (bgmmc.is_wei_decomp)
+        bgmmc.b_dt_sz = types::data_type_size(bgmmc.orig_wei_dt);
 
     bgmmc.is_bf32 = bm_conf_utils.is_bf32();
 
@@ -1021,6 +1034,18 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
     bgmmc.wei_zp_type = get_zp_type(attr, DNNL_ARG_WEIGHTS);
     bgmmc.dst_zp_type = get_zp_type(attr, DNNL_ARG_DST);
 
+    if (bgmmc.is_wei_decomp) {
+        // Weights zero points are applied during decompression.
+        const int wei_zp_mask = attr.zero_points_.get(DNNL_ARG_WEIGHTS);
+        VCONDCHECK_BG(one_of(wei_zp_mask, 0, 1 << (bgmmc.ndims - 1)),
+                VERBOSE_UNSUPPORTED_ZP_CFG);
+        bgmmc.wei_decomp_zp_type = bgmmc.wei_zp_type == brgemm_broadcast_t::none
+                ? brgemm_broadcast_t::none
+                : (wei_zp_mask == 0 ? brgemm_broadcast_t::per_tensor
+                                    : brgemm_broadcast_t::per_n);
+        bgmmc.wei_zp_type = brgemm_broadcast_t::none;
+    }
+
     VCONDCHECK_BG(
             IMPLICATION(!bm_conf_utils.is_int8(),
                     everyone_is(brgemm_broadcast_t::none, bgmmc.src_zp_type,
@@ -1091,6 +1116,11 @@ status_t init_brgemm_matmul_conf(cpu_isa_t isa, brgemm_matmul_conf_t &bgmmc,
             VERBOSE_UNSUPPORTED_TAG);
     VCHECK_BG(bm_conf_utils.set_or_check_B_tag(weights_md),
             VERBOSE_UNSUPPORTED_TAG);
+    VCONDCHECK_BG(IMPLICATION(bgmmc.is_wei_decomp,
+                          bm_conf_utils.check_is_plain(bgmmc.wei_tag)
+                                  || bm_conf_utils.check_is_transposed(
+                                          bgmmc.wei_tag)),
+            VERBOSE_UNSUPPORTED_TAG);
 
     bgmmc.req_wei_vnni_downconvert = bm_conf_utils.wei_down_convert_to_vnni();
 
@@ -181,6 +181,11 @@ struct brgemm_matmul_conf_t {
     int required_k_granularity;
     bool is_bf32 = false;
     bool req_wei_vnni_downconvert = false;
+    // Integer weights (orig_wei_dt) are decompressed to wei_dt while copying
+    // B into the buffer, weights zero points are subtracted there as well.
+    bool is_wei_decomp = false;
+    data_type_t orig_wei_dt = data_type::undef;
+    brgemm_broadcast_t wei_decomp_zp_type = brgemm_broadcast_t::none;
     bool is_runtime_M = false;
     bool is_runtime_N = false;
     bool is_runtime_K = false;
@@ -209,6 +214,9 @@ struct brgemm_matmul_conf_utils_t {
     }
 
     inline bool use_buffer_b(bool use_heuristic = true) const {
+        // Decompression happens only while copying B.
+        if (bgmmc.is_wei_decomp) return true;
+
         if (bgmmc.is_amx)
             // use b_buffer for AMX when:
             // - not bf32 && using non-blocked weights
@@ -55,36 +55,39 @@ graph::utils::optional_t<size_t> dnnl_layout_id_manager_t::set_mem_desc(
         const memory::desc &md) {
     std::lock_guard<std::mutex> lock(mem_descs_.m_);
     size_t layout_id = 0;
-    auto pos = std::find_if(mem_descs_.data_.begin(), mem_descs_.data_.end(),
-            [&](const memory::desc &val) -> bool { return val == md; });
+    const compact_md_t key(*md.get());
+    const auto pos = mem_descs_.positions_.find(key);
+    const bool found = pos != mem_descs_.positions_.end();
+    // Saves the md in the manager and returns its position.
+    auto save = [&]() {
+        mem_descs_.data_.emplace_back(md);
+        const size_t position = mem_descs_.data_.size() - 1;
+        mem_descs_.positions_.emplace(key, position);
+        return position;
+    };
 
 #ifdef DNNL_GRAPH_LAYOUT_DEBUG
-    if (pos != mem_descs_.data_.end()) {
+    if (found) {
         // if the md is already in the manager, it means the layout of the md
         // cannot be determined by the format tag value. For example, the md may
         // contain compensation values. For this case, we still use the position
         // as the layout id and use LAST_TAG as the offset to distinguish format
         // tag based layout id from position based layout id.
-        layout_id = static_cast<size_t>(
-                            std::distance(mem_descs_.data_.begin(), pos))
-                + LAST_TAG;
+        layout_id = pos->second + LAST_TAG;
     } else {
         // the md is not in the manager. If md is trivial and can be determined
         // simply by a format tag, we will not save the md and return the format
         // tag value directly as the layout id. Otherwise, the md will be saved
         // in the manager and a position based layout id will be returned.
         if (md.get_format_kind() != memory::format_kind::blocked) {
-            mem_descs_.data_.emplace_back(md);
-            layout_id = mem_descs_.data_.size() - 1 + LAST_TAG;
+            layout_id = save() + LAST_TAG;
         } else { // blocked format
             const size_t format_tag = static_cast<size_t>(get_format_tag(md));
             if (format_tag == dnnl_format_tag_undef
                     || format_tag >= dnnl_format_tag_last) {
                 // for format tag not supported by api, it's non-trivial and md
                 // cannot be determined by it.
-                mem_descs_.data_.emplace_back(md);
-                layout_id = static_cast<size_t>(mem_descs_.data_.size() - 1)
-                        + LAST_TAG;
+                layout_id = save() + LAST_TAG;
             } else {
                 // Check if md has extra flags. Note that since onednn didn't provide
                 // api to check extra flags, here we construct a temp md without extra
@@ -97,9 +100,7 @@ graph::utils::optional_t<size_t> dnnl_layout_id_manager_t::set_mem_desc(
                 memory::desc temp_md(dims, dtype,
                         static_cast<memory::format_tag>(format_tag));
                 if (md != temp_md) {
-                    mem_descs_.data_.emplace_back(md);
-                    layout_id = static_cast<size_t>(mem_descs_.data_.size() - 1)
-                            + LAST_TAG;
+                    layout_id = save() + LAST_TAG;
                 } else {
                     // finally, the md is trivial and can be determined by the
                     // format tag, we return the format tag as the layout id and
@@ -110,14 +111,12 @@ graph::utils::optional_t<size_t> dnnl_layout_id_manager_t::set_mem_desc(
         }
     }
 #else
-    if (pos != mem_descs_.data_.end()) {
+    if (found) {
         // the md is already in the manager and the position is returned.
-        layout_id = static_cast<size_t>(
-                std::distance(mem_descs_.data_.begin(), pos));
+        layout_id = pos->second;
     } else {
         // store the md in the manager and the position is returned.
-        mem_descs_.data_.emplace_back(md);
-        layout_id = static_cast<size_t>(mem_descs_.data_.size() - 1);
+        layout_id = save();
     }
 
 #endif
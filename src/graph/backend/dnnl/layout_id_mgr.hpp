@@ -18,6 +18,9 @@
 #define GRAPH_BACKEND_DNNL_LAYOUT_ID_MGR_HPP
 
 #include <mutex>
+#include <unordered_map>
+
+#include "common/compact_memory_desc.hpp"
 
 #include "graph/utils/any.hpp"
 #include "graph/utils/utils.hpp"
@@ -52,6 +55,9 @@ private:
 
     mutable struct {
         std::vector<memory::desc> data_;
+        // Positions of the saved mds in data_, to avoid comparing a new md
+        // against every saved one.
+        std::unordered_map<compact_md_t, size_t> positions_;
         mutable std::mutex m_;
     } mem_descs_;
 };
@@ -14,6 +14,7 @@
  * limitations under the License.
  *******************************************************************************/
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
@@ -26,6 +27,7 @@
 #include "compiler/ir/graph/pass/pass.hpp"
 #include "compiler/jit/compiler_driver.hpp"
 #include "compiler_partition_impl.hpp"
+#include "util/utils.hpp"
 
 #include "common/rw_mutex.hpp"
 #include "graph/interface/graph.hpp"
@@ -119,6 +121,25 @@ graph::status_t compiler_partition_impl_t::compile(
         const std::vector<graph::logical_tensor_t> &inputs,
         const std::vector<graph::logical_tensor_t> &outputs,
         const graph::engine_t *aengine) const {
+    std::shared_ptr<compiler_compiled_partition_impl_t> pimpl;
+    auto res = compile_impl(pimpl, inputs, outputs, aengine);
+    if (res != status::success) { return res; }
+    const size_t hot_hits
+            = gc::utils::compiler_configs_t::get().specialize_hot_shapes_;
+    if (pimpl->is_dynamic() && hot_hits > 0) {
+        pimpl->specializations_.reset(new shape_specializations_t(
+                std::static_pointer_cast<compiler_partition_impl_t>(clone()),
+                aengine, hot_hits));
+    }
+    compiled_partition->init(pimpl);
+    return res;
+}
+
+graph::status_t compiler_partition_impl_t::compile_impl(
+        std::shared_ptr<compiler_compiled_partition_impl_t> &compiled,
+        const std::vector<graph::logical_tensor_t> &inputs,
+        const std::vector<graph::logical_tensor_t> &outputs,
+        const graph::engine_t *aengine) const {
     try {
         graph::status_t res = status::success;
         // here we call infer_shape since logical tensor info
@@ -300,11 +321,10 @@ graph::status_t compiler_partition_impl_t::compile(
         std::shared_ptr<gc::jit_function_t> fptr
                 = gc::compiler_driver(ctx, backend_graph_obj, args);
 
-        auto pimpl = std::make_shared<compiler_compiled_partition_impl_t>(
+        compiled = std::make_shared<compiler_compiled_partition_impl_t>(
                 *aengine, inputs, outputs, fptr, graph_engine,
                 std::move(dyn_inputs), std::move(dyn_outputs),
                 engine_ref_data_ptr);
-        compiled_partition->init(pimpl);
         return res;
     } catch (...) { return graph::status::unimplemented; }
 }
@@ -367,10 +387,97 @@ compiler_compiled_partition_impl_t::~compiler_compiled_partition_impl_t() {
     graph_engine_->allocator_->release();
 }
 
+shape_specializations_t::shape_specializations_t(
+        std::shared_ptr<compiler_partition_impl_t> partition,
+        const graph::engine_t *engine, size_t hot_hits)
+    : partition_(std::move(partition)), engine_(engine), hot_hits_(hot_hits) {
+    // the kernels are compiled for the engine after the user may have
+    // destroyed it
+    const_cast<graph::engine_t *>(engine_)->retain();
+}
+
+shape_specializations_t::~shape_specializations_t() {
+    // the kernels being compiled refer to the partition and the engine
+    for (auto &job : jobs_) {
+        job.wait();
+    }
+    const_cast<graph::engine_t *>(engine_)->release();
+}
+
+std::vector<graph::dim_t> shape_specializations_t::make_key(
+        const std::vector<graph::tensor_t> &inputs,
+        const std::vector<graph::tensor_t> &outputs) {
+    // the static kernel is compiled for the strides or the layout of each
+    // tensor as well as for its shape
+    std::vector<graph::dim_t> key;
+    for (auto *tensors : {&inputs, &outputs}) {
+        for (auto &t : *tensors) {
+            auto lt = t.get_logical_tensor();
+            key.push_back(lt.ndims);
+            key.insert(key.end(), lt.dims, lt.dims + lt.ndims);
+            key.push_back(lt.layout_type);
+            if (lt.layout_type == graph::layout_type::strided) {
+                key.insert(key.end(), lt.layout.strides,
+                        lt.layout.strides + lt.ndims);
+            } else if (lt.layout_type == graph::layout_type::opaque) {
+                key.push_back(static_cast<graph::dim_t>(lt.layout.layout_id));
+            }
+        }
+    }
+    return key;
+}
+
+std::shared_ptr<compiler_compiled_partition_impl_t>
+shape_specializations_t::get(const std::vector<graph::tensor_t> &inputs,
+        const std::vector<graph::tensor_t> &outputs) {
+    auto key = make_key(inputs, outputs);
+    std::lock_guard<std::mutex> lock(lock_);
+    auto itr = entries_.find(key);
+    if (itr == entries_.end()) {
+        if (entries_.size() >= max_entries) { return nullptr; }
+        itr = entries_.emplace(key, entry_t()).first;
+    }
+    auto &entry = itr->second;
+    if (entry.kernel_ || entry.compiling_) { return entry.kernel_; }
+    if (++entry.hits_ < hot_hits_) { return nullptr; }
+
+    // the shape is hot, compile a static kernel for it in the background
+    // and keep executing the dynamic one meanwhile
+    entry.compiling_ = true;
+    std::vector<graph::logical_tensor_t> in_lts, out_lts;
+    for (auto &in : inputs) {
+        in_lts.push_back(in.get_logical_tensor());
+    }
+    for (auto &out : outputs) {
+        out_lts.push_back(out.get_logical_tensor());
+    }
+    jobs_.emplace_back(std::async(std::launch::async,
+            [this, key, in_lts, out_lts]() {
+                // compile a clone as compiling is not reentrant
+                auto partition = std::static_pointer_cast<
+                        compiler_partition_impl_t>(partition_->clone());
+                std::shared_ptr<compiler_compiled_partition_impl_t> kernel;
+                auto res = partition->compile_impl(
+                        kernel, in_lts, out_lts, engine_);
+                // a shape that fails to compile is left to the dynamic kernel
+                if (res != status::success || kernel->is_dynamic()) {
+                    return;
+                }
+                std::lock_guard<std::mutex> lock(lock_);
+                entries_[key].kernel_ = std::move(kernel);
+            }));
+    return nullptr;
+}
+
 graph::status_t compiler_compiled_partition_impl_t::execute(
         const graph::stream_t *astream,
         const std::vector<graph::tensor_t> &inputs,
         const std::vector<graph::tensor_t> &outputs) {
+    if (specializations_) {
+        if (auto kernel = specializations_->get(inputs, outputs)) {
+            return kernel->execute(astream, inputs, outputs);
+        }
+    }
     // set backend runtime stream
     compiler_graph_stream_t backend_stream {graph_engine_.get(), astream};
     std::vector<gc::generic_val> generic_args;
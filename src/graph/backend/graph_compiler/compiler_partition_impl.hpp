@@ -17,7 +17,10 @@
 #define BACKEND_GRAPH_COMPILER_COMPILER_PARTITION_IMPL_HPP
 
 #include <cassert>
+#include <future>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -48,8 +51,11 @@ struct engine_ref_data {
     std::mutex global_mutex;
 };
 
+class compiler_compiled_partition_impl_t;
+
 class compiler_partition_impl_t : public partition_impl_t {
     friend class compiler_backend_t;
+    friend class shape_specializations_t;
 
 public:
     compiler_partition_impl_t(graph::engine_kind_t engine_kind,
@@ -123,11 +129,55 @@ public:
 
 protected:
     bool is_init_ = false;
+    // compiles the partition for the given shapes, which may be dynamic
+    graph::status_t compile_impl(
+            std::shared_ptr<compiler_compiled_partition_impl_t> &compiled,
+            const std::vector<graph::logical_tensor_t> &inputs,
+            const std::vector<graph::logical_tensor_t> &outputs,
+            const graph::engine_t *aengine) const;
     mutable std::vector<std::shared_ptr<graph::op_t>> copied_ops_;
     mutable std::mutex mtx_;
     std::string pname_;
 };
+// Static kernels of a dynamic partition for the input shapes it is executed
+// with the most. A static kernel for a shape is compiled in the background
+// once the partition has been executed with the shape the given number of
+// times, and is used instead of the dynamic kernel from then on.
+class shape_specializations_t {
+public:
+    shape_specializations_t(
+            std::shared_ptr<compiler_partition_impl_t> partition,
+            const graph::engine_t *engine, size_t hot_hits);
+    ~shape_specializations_t();
+    // returns the static kernel for the shapes of the tensors if it is ready
+    std::shared_ptr<compiler_compiled_partition_impl_t> get(
+            const std::vector<graph::tensor_t> &inputs,
+            const std::vector<graph::tensor_t> &outputs);
+    // returns the key of the static kernel for the tensors, made of the
+    // shapes and the strides or the layouts of the tensors
+    static std::vector<graph::dim_t> make_key(
+            const std::vector<graph::tensor_t> &inputs,
+            const std::vector<graph::tensor_t> &outputs);
+
+private:
+    struct entry_t {
+        size_t hits_ = 0;
+        bool compiling_ = false;
+        std::shared_ptr<compiler_compiled_partition_impl_t> kernel_;
+    };
+    // the number of shapes counted, to bound the memory and the compilations
+    static constexpr size_t max_entries = 64;
+    std::shared_ptr<compiler_partition_impl_t> partition_;
+    const graph::engine_t *engine_;
+    size_t hot_hits_;
+    std::mutex lock_;
+    std::map<std::vector<graph::dim_t>, entry_t> entries_;
+    std::vector<std::future<void>> jobs_;
+};
+
 class compiler_compiled_partition_impl_t : public compiled_partition_impl_t {
+    friend class compiler_partition_impl_t;
+
 public:
     compiler_compiled_partition_impl_t(const graph::engine_t &engine,
             const std::vector<graph::logical_tensor_t> &inputs,
@@ -139,6 +189,7 @@ public:
             std::vector<gc::runtime::dynamic_tensor_t> &&dyn_outputs,
             const std::shared_ptr<engine_ref_data> &engine_ref_data_ptr);
     virtual ~compiler_compiled_partition_impl_t();
+    bool is_dynamic() const { return !dyn_inputs_.empty(); }
     graph::status_t execute(const graph::stream_t *astream,
             const std::vector<graph::tensor_t> &inputs,
             const std::vector<graph::tensor_t> &outputs) override;
@@ -159,6 +210,7 @@ private:
             graph_engine_;
     std::vector<gc::runtime::dynamic_tensor_t> dyn_inputs_, dyn_outputs_;
     const std::shared_ptr<engine_ref_data> engine_ref_data_ptr_;
+    std::unique_ptr<shape_specializations_t> specializations_;
 };
 
 } // namespace compiler_impl
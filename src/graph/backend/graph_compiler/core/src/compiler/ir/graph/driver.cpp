@@ -71,6 +71,12 @@ create_default_graph_flow(const context_ptr &ctx) {
     pre_tune_passes.push_back(create_graph_pass("annotate_fusion_break",
             quantize::annotate_fusion_break, {}, pass_type::pre_tune,
             sc_opt_level::lv2, true));
+    if (ctx->flags_.mixed_fusion_) {
+        // should be executed before the matmuls are configured and inlined
+        pre_tune_passes.push_back(create_graph_pass("horizontal_matmul_merge",
+                horizontal_matmul_merge, {}, pass_type::pre_tune,
+                sc_opt_level::lv2, true));
+    }
     pre_tune_passes.push_back(create_graph_pass("annotate_config",
             annotate_config, {}, pass_type::pre_tune, sc_opt_level::lv2, true));
     pre_tune_passes.push_back(create_graph_pass("graph_inline", graph_inline,
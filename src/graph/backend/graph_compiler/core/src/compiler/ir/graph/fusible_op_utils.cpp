@@ -135,8 +135,7 @@ ir_module_ptr fusible_op_get_func(fusible_op_t *op, const context_ptr &ctx) {
             copyable, "The fusible op should be copyable: " << op->op_name_);
     auto copied = copyable->copy(ins, outs, g);
     copied->info_.cur_impl_ = op->info_.cur_impl_;
-    COMPILE_ASSERT(copied->get_outputs().size() == 1,
-            "Currently only support 1 output only");
+    // every output of the op is an output of the graph
     g.make_output(outs);
     g.attrs_.set(mixed_partition_hint::single_op_graph, true);
     // create dummy parti
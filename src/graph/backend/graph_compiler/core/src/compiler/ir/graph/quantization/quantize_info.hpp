@@ -48,6 +48,10 @@ constexpr const char *weight_channel_axis = "weight_channel_axis";
 constexpr const char *output_channel_axis
         = "output_channel_axis"; // output of tuanble ops
 constexpr const char *asymmetric = "asymmetric";
+// grouped quantization, elements along the group axis share the scale and
+// zero point within a group of group size elements.
+constexpr const char *group_size = "group_size";
+constexpr const char *group_axis = "group_axis";
 // pass attributes
 constexpr const char *mixed_dtype = "mixed_dtype";
 constexpr const char *may_quantize = "may_quantize";
@@ -68,6 +72,11 @@ enum class tensor_type { input_tensor, weight_tensor, bias_tensor };
  * points which axis is channel.
  * @param asymmetric_ whether use symmetric or asymmetric quantization.(not used
  * yet)
+ * @param group_size_ if not 0, the scales and zero points have the shape of
+ * the tensor with the group axis divided by the group size, each of them is
+ * shared by group size consecutive elements along the group axis. Only
+ * supported by dequantize.
+ * @param group_axis_ the axis divided into groups.
  * */
 
 struct quantize_infos_t {
@@ -77,6 +86,8 @@ struct quantize_infos_t {
     bool per_channel_ = false;
     int channel_axis_ = 0;
     bool asymmetric_ = false;
+    int group_size_ = 0;
+    int group_axis_ = 0;
     quantize_infos_t() = default;
     quantize_infos_t(sc_data_type_t dtype, const std::vector<float> &scales,
             const std::vector<int> &zero_points, bool per_channel = false,
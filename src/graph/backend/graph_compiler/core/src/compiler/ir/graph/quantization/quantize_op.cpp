@@ -50,6 +50,8 @@ quantize_infos_t get_quantize_info_from_attrs(const any_map_t &attrs) {
             || infos.scales_.size() > 1;
     infos.channel_axis_ = attrs.get_or_else(attr_keys::channel_axis, 0);
     infos.asymmetric_ = attrs.get_or_else(attr_keys::asymmetric, true);
+    infos.group_size_ = attrs.get_or_else(attr_keys::group_size, 0);
+    infos.group_axis_ = attrs.get_or_else(attr_keys::group_axis, 0);
     assert(utils::is_one_of(infos.dtype_, datatypes::f32, datatypes::bf16,
                    datatypes::u8, datatypes::s8)
             && ((infos.per_channel_ && !infos.scales_.empty())
@@ -191,10 +193,33 @@ void dequantize_op_t::get_graph_impl(std::shared_ptr<sc_graph_t> &graph) {
     std::vector<float> scales = qinfos.scales_;
     std::shared_ptr<static_data_t> scales_ptr
             = std::make_shared<static_data_t>(scales);
+    const sc_dims &plain_dims = inputs[0]->details_.get_plain_dims();
+    const bool grouped = qinfos.group_size_ > 0;
+    // the input viewed with the group axis split into the groups and the
+    // elements of a group, the scales broadcast over the latter
+    sc_dims grouped_dims;
     sc_dims scales_plain_dims = {1};
-    if (scales.size() > 1) {
-        scales_plain_dims.resize(
-                inputs[0]->details_.get_plain_dims().size(), 1);
+    if (grouped) {
+        const int axis = qinfos.group_axis_;
+        const sc_dim group_size = qinfos.group_size_;
+        COMPILE_ASSERT(axis >= 0 && axis < static_cast<int>(plain_dims.size())
+                        && plain_dims[axis] % group_size == 0,
+                "Dequantize expects the group axis to be divisible by the "
+                "group size, got dims: "
+                        << utils::print_vector(plain_dims)
+                        << ", group axis: " << axis
+                        << ", group size: " << group_size);
+        grouped_dims = plain_dims;
+        grouped_dims[axis] /= group_size;
+        grouped_dims.insert(grouped_dims.begin() + axis + 1, group_size);
+        scales_plain_dims = grouped_dims;
+        scales_plain_dims[axis + 1] = 1;
+        COMPILE_ASSERT(math_utils::get_dims_product(scales_plain_dims)
+                        == static_cast<sc_dim>(scales.size()),
+                "Dequantize expects a scale per group, got "
+                        << scales.size() << " scales.");
+    } else if (scales.size() > 1) {
+        scales_plain_dims.resize(plain_dims.size(), 1);
         scales_plain_dims[qinfos.channel_axis_]
                 = static_cast<int>(scales.size());
     }
@@ -203,18 +228,25 @@ void dequantize_op_t::get_graph_impl(std::shared_ptr<sc_graph_t> &graph) {
                     {"plain_dims", scales_plain_dims},
                     {"format", sc_data_format_t()}, {"all_positive", true}});
     auto f32_cast = graph->make("cast", inputs, {}, {{"dtype", qinfos.dtype_}});
+    if (grouped) {
+        f32_cast = graph->make("tensor_view", f32_cast->get_outputs(), {},
+                {{"shape", grouped_dims}});
+    }
 
     bool all_zero = std::all_of(qinfos.zero_points_.begin(),
             qinfos.zero_points_.end(), [](int x) { return x == 0; });
     if (!all_zero) {
         std::vector<float> zero_points(
                 qinfos.zero_points_.begin(), qinfos.zero_points_.end());
+        sc_dims zero_points_plain_dims
+                = {static_cast<sc_dim>(zero_points.size())};
+        if (grouped && zero_points.size() > 1) {
+            zero_points_plain_dims = scales_plain_dims;
+        }
         auto const_zero_points = graph->make("constant", {}, {},
                 {{"values", std::make_shared<static_data_t>(zero_points)},
                         {"dtype", datatypes::f32},
-                        {"plain_dims",
-                                sc_dims {static_cast<sc_dim>(
-                                        zero_points.size())}},
+                        {"plain_dims", zero_points_plain_dims},
                         {"format", sc_data_format_t()}});
         f32_cast = graph->make("sub",
                 {f32_cast->get_outputs()[0],
@@ -224,6 +256,10 @@ void dequantize_op_t::get_graph_impl(std::shared_ptr<sc_graph_t> &graph) {
     auto mul_scale = graph->make("mul",
             {f32_cast->get_outputs()[0], const_scales->get_outputs()[0]}, {},
             {});
+    if (grouped) {
+        mul_scale = graph->make("tensor_view", mul_scale->get_outputs(), {},
+                {{"shape", plain_dims}});
+    }
     graph->make_output(mul_scale->get_outputs());
 }
 
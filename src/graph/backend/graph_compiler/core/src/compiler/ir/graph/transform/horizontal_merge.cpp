@@ -14,14 +14,19 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
 #include <map>
+#include <utility>
 #include "../fusible_op.hpp"
 #include "../graph_op.hpp"
 #include "../pass/pass.hpp"
 #include "../visitor.hpp"
 #include "transform.hpp"
 #include <compiler/ir/graph/fused_op.hpp>
+#include <ops/matmul.hpp>
+#include <runtime/config.hpp>
 #include <unordered_set>
+#include <util/math_utils.hpp>
 
 namespace dnnl {
 namespace impl {
@@ -96,6 +101,106 @@ void horizontal_merge(sc_graph_t &graph, const context_ptr &ctx) {
     graph.reset_op_ids();
 }
 
+static bool is_constant_op(const sc_op *node) {
+    return node->isa<constant_op_t>()
+            || node->attrs_.get_or_else("constant", const_kind::not_const)
+            != const_kind::not_const;
+}
+
+// a matmul without bias and transposes, multiplying by a constant 2D weight
+static bool is_batchable_matmul(const sc_op_ptr &node) {
+    if (!node->isa<ops::matmul_op>() || node->is_dynamic()
+            || node->get_inputs().size() != 2) {
+        return false;
+    }
+    if (node->attrs_.get_or_else("transpose_a", false)
+            || node->attrs_.get_or_else("transpose_b", false)) {
+        return false;
+    }
+    auto &weight = node->get_inputs()[1];
+    return weight->details_.get_plain_dims().size() == 2
+            && is_constant_op(weight->producer_owner_);
+}
+
+static bool can_batch_matmuls(const sc_op_ptr &a, const sc_op_ptr &b) {
+    auto &wa = a->get_inputs()[1]->details_;
+    auto &wb = b->get_inputs()[1]->details_;
+    return wa.dtype_ == wb.dtype_
+            && wa.get_plain_dims()[0] == wb.get_plain_dims()[0]
+            && a->attrs_ == b->attrs_;
+}
+
+// a matmul whose output has fewer blocks than there are threads cannot keep
+// all the threads busy on its own
+static bool is_small_matmul(const sc_op_ptr &node, int num_threads) {
+    const sc_dim block = 32;
+    auto &dims = node->get_outputs()[0]->details_.get_plain_dims();
+    sc_dim m = 1;
+    for (size_t i = 0; i + 1 < dims.size(); i++) {
+        m *= dims[i];
+    }
+    return utils::divide_and_ceil(m, block)
+            * utils::divide_and_ceil(dims.back(), block)
+            < static_cast<size_t>(num_threads);
+}
+
+// replaces the matmuls with a single matmul by the weights concatenated along
+// N, whose output is split back into the outputs of the matmuls
+static void do_batch_matmuls(
+        sc_graph_t &graph, const std::vector<sc_op_ptr> &matmuls) {
+    std::vector<graph_tensor_ptr> weights;
+    sc_dims shapes;
+    for (auto &op : matmuls) {
+        weights.emplace_back(op->get_inputs()[1]);
+        shapes.emplace_back(op->get_inputs()[1]->details_.get_plain_dims()[1]);
+    }
+    // the concat of constant weights is done once by constant folding
+    auto weight = graph.make("concat", weights, {}, {{"axis", 1}});
+    auto matmul = graph.make("matmul",
+            {matmuls[0]->get_inputs()[0], weight->get_outputs()[0]}, {},
+            matmuls[0]->attrs_);
+    int rank = static_cast<int>(
+            matmul->get_outputs()[0]->details_.get_plain_dims().size());
+    auto split = graph.make("split", matmul->get_outputs(), {},
+            {{"dim", rank - 1}, {"shapes", shapes}});
+    for (size_t i = 0; i < matmuls.size(); i++) {
+        matmuls[i]->get_outputs()[0]->replace_with(split->get_outputs()[i]);
+        matmuls[i]->remove();
+    }
+}
+
+void horizontal_matmul_merge(sc_graph_t &graph, const context_ptr &ctx) {
+    if (graph.is_dynamic()) { return; }
+    const int num_threads = runtime_config_t::get().get_num_threads();
+    if (num_threads <= 1) { return; }
+    // the groups of matmuls that can be batched, in the order of visiting
+    std::vector<std::vector<sc_op_ptr>> groups;
+    auto vis = op_visitor_t::bfs();
+    vis.visit_graph(graph, [&](op_visitor_t *vis, const sc_op_ptr &node) {
+        if (!is_batchable_matmul(node)) { return; }
+        for (auto &group : groups) {
+            if (group[0]->get_inputs()[0] == node->get_inputs()[0]
+                    && can_batch_matmuls(group[0], node)) {
+                group.emplace_back(node);
+                return;
+            }
+        }
+        groups.emplace_back(std::vector<sc_op_ptr> {node});
+    });
+    bool changed = false;
+    for (auto &group : groups) {
+        if (group.size() < 2) { continue; }
+        bool has_small = std::any_of(group.begin(), group.end(),
+                [&](const sc_op_ptr &op) {
+                    return is_small_matmul(op, num_threads);
+                });
+        if (!has_small) { continue; }
+        do_batch_matmuls(graph, group);
+        changed = true;
+    }
+    if (changed) { graph.reset_op_ids(); }
+}
+
 } // namespace gc
 } // namespace graph
 } // namespace impl
@@ -386,7 +386,8 @@ SC_INTERNAL_API void layout_propagation(
                     || node->isa<binary_elementwise_op_t>()
                     || node->isa<tensor_view_op_t>()
                     || node->isa<ops::dynamic_reshape_op>()
-                    || node->isa<concat_op_t>() || node->isa<select_op_t>()) {
+                    || node->isa<concat_op_t>() || node->isa<split_op_t>()
+                    || node->isa<select_op_t>()) {
                 std::vector<sc_data_format_t> old_formats;
                 std::vector<std::vector<sc_data_format_t>>
                         input_format_candidates;
@@ -58,6 +58,13 @@ static std::vector<std::pair<int, sc_op_ptr>> find_quantize_aware_nodes(
     return aware_nodes;
 }
 
+// grouped dequantize stays as a decompression of the weight into the floating
+// point type, and does not turn the computation into a quantized one.
+static bool is_grouped_dequantize(const sc_op_ptr &node) {
+    return node->isa<dequantize_op_t>()
+            && node->attrs_.get_or_else(attr_keys::group_size, 0) > 0;
+}
+
 template <typename T>
 void has_key_and_set(any_map_t &attrs, const std::string &key,
         const sc_op_ptr &aware_node,
@@ -248,8 +255,9 @@ void change_weight_u8_to_s8(sc_graph_t &mgr, const context_ptr &ctx) {
     if (ctx->use_amx()) { return; }
     op_visitor_t vis = op_visitor_t::dfs_topology_sort(mgr.ops_.size());
     vis.visit_graph(mgr, [&](op_visitor_t *vis, const sc_op_ptr &node) {
-        if (node->isa<dequantize_op_t>()
-                || node->isa<dynamic_dequantize_op_t>()) {
+        if ((node->isa<dequantize_op_t>()
+                    || node->isa<dynamic_dequantize_op_t>())
+                && !is_grouped_dequantize(node)) {
             bool dyn_quan_cur = node->isa<dynamic_dequantize_op_t>();
             if (node->get_inputs()[0]->details_.dtype_ == datatypes::u8) {
                 bool need_s8 = false;
@@ -382,6 +390,7 @@ SC_INTERNAL_API void quantize_info_propagation(
     change_weight_u8_to_s8(mgr, ctx);
     op_visitor_t vis = op_visitor_t::dfs_topology_sort(mgr.ops_.size());
     vis.visit_graph(mgr, [&](op_visitor_t *vis, const sc_op_ptr &node) {
+        if (is_grouped_dequantize(node)) { return; }
         if (node->isa<dequantize_op_t>() || node->isa<dynamic_dequantize_op_t>()
                 || (node->isa<op_traits::may_quantize_t>()
                         && !node->isa<concat_op_t>())
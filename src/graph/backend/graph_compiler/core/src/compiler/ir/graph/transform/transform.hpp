@@ -77,6 +77,14 @@ void graph_simplify(
 void horizontal_merge(
         sc_graph_t &graph, const context_ptr &ctx = get_default_context());
 
+/**
+ * Batches independent matmuls that share the input and multiply it by
+ * constant weights with different N into a single matmul with the weights
+ * concatenated, when the matmuls are too small to use all the threads.
+ * */
+SC_INTERNAL_API void horizontal_matmul_merge(
+        sc_graph_t &graph, const context_ptr &ctx = get_default_context());
+
 SC_INTERNAL_API void global_reschedule(
         sc_graph_t &graph, const context_ptr &ctx = get_default_context());
 
@@ -14,17 +14,274 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
 #include <functional>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <string>
+#include <utility>
 #include "jit.hpp"
 #include <compiler/ir/graph/driver.hpp>
+#include <compiler/ir/graph/fusible_op.hpp>
 #include <compiler/ir/graph/lowering.hpp>
 #include <compiler/ir/graph/pass/graph_code_cache.hpp>
+#include <compiler/ir/graph/pass/pass.hpp>
+#include <runtime/config.hpp>
+#include <runtime/logging.hpp>
+#include <unordered_map>
+#include <util/hash_utils.hpp>
+#include <util/utils.hpp>
 
 namespace dnnl {
 namespace impl {
 namespace graph {
 namespace gc {
 
+SC_MODULE(jit.compiler_driver)
+
+namespace {
+// the alternative fusion decisions to measure, the first one is the default
+struct fusion_policy_t {
+    const char *name_;
+    void (*apply_)(scflags_t &flags);
+};
+
+const fusion_policy_t fusion_policies[] = {
+        {"default", [](scflags_t &) {}},
+        // fuse whatever the rules allow, without the cost model vetoes
+        {"no_cost_model",
+                [](scflags_t &flags) { flags.use_cost_model_ = false; }},
+        // fuse by the fusion manager only, keeping more ops separate
+        {"no_mixed_fusion",
+                [](scflags_t &flags) { flags.mixed_fusion_ = false; }},
+};
+
+// the persistent database of the fastest fusion policy for each graph, kept
+// in a text file with a line of "<graph key> <policy name>" per graph
+class fusion_db_t {
+public:
+    explicit fusion_db_t(const std::string &path) : path_(path) {
+        std::ifstream in(path_);
+        size_t key;
+        std::string name;
+        while (in >> std::hex >> key >> name) {
+            entries_[key] = name;
+        }
+    }
+
+    const fusion_policy_t *find(size_t key) {
+        std::lock_guard<std::mutex> guard(lock_);
+        auto itr = entries_.find(key);
+        if (itr == entries_.end()) { return nullptr; }
+        for (auto &policy : fusion_policies) {
+            if (itr->second == policy.name_) { return &policy; }
+        }
+        return nullptr;
+    }
+
+    void add(size_t key, const fusion_policy_t &policy) {
+        std::lock_guard<std::mutex> guard(lock_);
+        entries_[key] = policy.name_;
+        std::ofstream out(path_, std::ios::app);
+        out << std::hex << key << ' ' << policy.name_ << '\n';
+        if (!out) {
+            SC_MODULE_WARN << "Cannot write the fusion database " << path_;
+        }
+    }
+
+    static fusion_db_t *get() {
+        const auto &path = utils::compiler_configs_t::get().fusion_db_;
+        if (path.empty()) { return nullptr; }
+        static fusion_db_t db(path);
+        return &db;
+    }
+
+private:
+    std::string path_;
+    std::mutex lock_;
+    std::unordered_map<size_t, std::string> entries_;
+};
+
+// fills the buffer with random values of the data type, so that the timings
+// are not skewed by the special handling of zeros or denormals
+void fill_random(
+        std::vector<char> &buffer, sc_data_etype etype, std::mt19937 &gen) {
+    std::uniform_real_distribution<float> real_dist(-1.f, 1.f);
+    // integer tensors may hold indices, so they are kept small
+    std::uniform_int_distribution<int> int_dist(0, 7);
+    std::uniform_int_distribution<int> byte_dist(0, 255);
+    const size_t elem_size = utils::get_sizeof_etype(etype);
+    const size_t num_elems = elem_size ? buffer.size() / elem_size : 0;
+    char *data = buffer.data();
+    for (size_t i = 0; i < num_elems; i++) {
+        switch (etype) {
+            case sc_data_etype::F32: {
+                float v = real_dist(gen);
+                memcpy(data + i * elem_size, &v, elem_size);
+                break;
+            }
+            case sc_data_etype::BF16: {
+                float v = real_dist(gen);
+                uint32_t bits;
+                memcpy(&bits, &v, sizeof(bits));
+                uint16_t bf16 = static_cast<uint16_t>(bits >> 16);
+                memcpy(data + i * elem_size, &bf16, elem_size);
+                break;
+            }
+            case sc_data_etype::F16: {
+                // a random sign, exponent of [2^-7, 2^-1] and mantissa
+                uint16_t f16 = static_cast<uint16_t>(
+                        ((byte_dist(gen) & 1) << 15)
+                        | ((8 + int_dist(gen) % 7) << 10)
+                        | (byte_dist(gen) << 2));
+                memcpy(data + i * elem_size, &f16, elem_size);
+                break;
+            }
+            case sc_data_etype::S8:
+            case sc_data_etype::U8:
+                data[i] = static_cast<char>(byte_dist(gen));
+                break;
+            case sc_data_etype::BOOLEAN:
+                data[i] = static_cast<char>(int_dist(gen) & 1);
+                break;
+            default: {
+                // other integers are stored in the lowest bytes
+                uint64_t v = static_cast<uint64_t>(int_dist(gen));
+                memcpy(data + i * elem_size, &v,
+                        std::min(elem_size, sizeof(v)));
+                break;
+            }
+        }
+    }
+}
+
+// returns the ops of the copy of the graph that match the args. The copy keeps
+// the order of the ops, but renumbers them when the graph has removed ops
+std::vector<sc_op_ptr> find_copied_args(const sc_graph_t &graph,
+        const sc_graph_t &copied, const std::vector<sc_op_ptr> &args) {
+    std::vector<sc_op_ptr> live_ops;
+    for (auto &op : graph.ops_) {
+        if (!op->is_removed_) { live_ops.emplace_back(op); }
+    }
+    COMPILE_ASSERT(live_ops.size() == copied.ops_.size(),
+            "The copied graph does not match the graph");
+    std::sort(live_ops.begin(), live_ops.end(),
+            [](const sc_op_ptr &a, const sc_op_ptr &b) {
+                return a->logical_op_id_ < b->logical_op_id_;
+            });
+    std::unordered_map<int, sc_op_ptr> copied_by_id;
+    for (auto &op : copied.ops_) {
+        copied_by_id[op->logical_op_id_] = op;
+    }
+    std::vector<sc_op_ptr> copied_args;
+    for (auto &arg : args) {
+        auto itr = std::find(live_ops.begin(), live_ops.end(), arg);
+        COMPILE_ASSERT(itr != live_ops.end(), "The arg is not in the graph");
+        auto copied_itr = copied_by_id.find(
+                static_cast<int>(std::distance(live_ops.begin(), itr)));
+        COMPILE_ASSERT(copied_itr != copied_by_id.end(),
+                "The arg is not in the copied graph");
+        copied_args.emplace_back(copied_itr->second);
+    }
+    return copied_args;
+}
+
+// compiles a copy of the graph with the fusion policy and returns the best
+// time of several executions on random inputs of the arguments' sizes
+double measure_fusion_policy(const context_ptr &ctx, const sc_graph_t &graph,
+        const std::vector<sc_op_ptr> &args, const fusion_policy_t &policy) {
+    constexpr int num_runs = 5;
+    auto policy_ctx = std::make_shared<context_t>(*ctx);
+    policy.apply_(policy_ctx->flags_);
+    sc_graph_t copied = copy_graph(graph);
+    std::vector<sc_op_ptr> copied_args;
+    if (args.empty()) {
+        copied_args = copied.get_input_ops();
+        auto outs = copied.get_output_ops();
+        copied_args.insert(copied_args.end(), outs.begin(), outs.end());
+    } else {
+        copied_args = find_copied_args(graph, copied, args);
+    }
+    graph_driver(copied, policy_ctx);
+    auto irm = lower_graph(policy_ctx, copied, copied_args);
+    auto func = jit_engine_t::make(policy_ctx)->get_entry_func(irm, true);
+
+    std::vector<std::vector<char>> buffers;
+    buffers.reserve(copied_args.size());
+    std::vector<generic_val> gargs;
+    std::mt19937 gen(0);
+    for (auto &arg : copied_args) {
+        auto &tsr = arg->isa<input_op>() ? arg->get_outputs()[0]
+                                         : arg->get_inputs()[0];
+        auto &dims = tsr->details_.get_blocking_dims();
+        size_t size = utils::get_sizeof_type(tsr->details_.dtype_);
+        for (auto d : dims) {
+            size *= d;
+        }
+        buffers.emplace_back(size);
+        fill_random(buffers.back(), tsr->details_.dtype_.type_code_, gen);
+        gargs.emplace_back(static_cast<void *>(buffers.back().data()));
+    }
+    // the first run also folds the constants
+    func->call_generic_default(gargs.data());
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < num_runs; i++) {
+        auto start = std::chrono::steady_clock::now();
+        func->call_generic_default(gargs.data());
+        std::chrono::duration<double> elapsed
+                = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+} // namespace
+
+context_ptr tune_fusion_policy(const context_ptr &ctx, const sc_graph_t &graph,
+        const std::vector<sc_op_ptr> &args) {
+    auto db = fusion_db_t::get();
+    if (!db || graph.is_dynamic()) { return ctx; }
+    size_t key = graph.hash_contents();
+    hash_combine(key, runtime_config_t::get().get_num_threads());
+    hash_combine(key, static_cast<int>(ctx->flags_.opt_level_));
+    const fusion_policy_t *best = db->find(key);
+    if (!best) {
+        // graphs with ops that cannot be copied are not measured
+        if (copy_graph(graph).empty()) { return ctx; }
+        double best_time = std::numeric_limits<double>::max();
+        for (auto &policy : fusion_policies) {
+            double time;
+            try {
+                time = measure_fusion_policy(ctx, graph, args, policy);
+            } catch (const std::exception &e) {
+                SC_MODULE_WARN << "Fusion policy " << policy.name_
+                               << " failed: " << e.what();
+                continue;
+            }
+            SC_MODULE_INFO << "Fusion policy " << policy.name_ << ": "
+                           << time * 1e3 << " ms";
+            if (time < best_time) {
+                best_time = time;
+                best = &policy;
+            }
+        }
+        // nothing is recorded, so that the policies are measured again by
+        // the next compilation
+        if (!best) {
+            SC_MODULE_WARN << "All fusion policies failed, using the default";
+            return ctx;
+        }
+        db->add(key, *best);
+    }
+    auto ret = std::make_shared<context_t>(*ctx);
+    best->apply_(ret->flags_);
+    return ret;
+}
+
 SC_API std::shared_ptr<jit_function_t> compiler_driver(const context_ptr &ctx,
         sc_graph_t &graph,
         const std::function<std::vector<sc_op_ptr>(sc_graph_t &graph)>
@@ -59,8 +316,10 @@ SC_API std::shared_ptr<jit_function_t> compiler_driver(const context_ptr &ctx,
         sc_graph_t &graph, const std::vector<sc_op_ptr> &args,
         const dnnl::impl::graph::gc::graph_config *in_cfg,
         ir_module_ptr *out_ir_module) {
+    // fusion decisions are measured unless the caller gives the config
+    auto tuned_ctx = in_cfg ? ctx : tune_fusion_policy(ctx, graph, args);
     return compiler_driver(
-            ctx, graph, [&args](sc_graph_t &) { return args; }, in_cfg,
+            tuned_ctx, graph, [&args](sc_graph_t &) { return args; }, in_cfg,
             out_ir_module);
 }
 
@@ -59,6 +59,20 @@ SC_API std::shared_ptr<jit_function_t> compiler_driver(const context_ptr &ctx,
         sc_graph_t &graph, const std::vector<sc_op_ptr> &args,
         const dnnl::impl::graph::gc::graph_config *in_cfg = nullptr,
         ir_module_ptr *out_ir_module = nullptr);
+
+/**
+ * Chooses the fusion decisions of the graph by the fusion database, set by
+ * SC_FUSION_DB. The graph unknown to the database is compiled and executed on
+ * random inputs with each policy, and the fastest one is recorded.
+ * @param ctx compiler context
+ * @param graph the graph before the graph passes
+ * @param args the arguments Ops of the graph, or empty for the input Ops
+ * followed by the output Ops
+ * @returns the context with the chosen flags, or ctx if the database is not
+ * set or no policy could be measured
+ */
+SC_INTERNAL_API context_ptr tune_fusion_policy(const context_ptr &ctx,
+        const sc_graph_t &graph, const std::vector<sc_op_ptr> &args);
 } // namespace gc
 } // namespace graph
 } // namespace impl
@@ -19,6 +19,7 @@
 #include <utility>
 
 #include <fstream>
+#include <stdio.h>
 #include <stdlib.h>
 #include "llvm_jit.hpp"
 #include "llvm_jit_resolver.hpp"
@@ -29,16 +30,22 @@
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
 #include <llvm/ExecutionEngine/JITEventListener.h>
 #include <llvm/ExecutionEngine/MCJIT.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
 #include <llvm/ExecutionEngine/SectionMemoryManager.h>
 #include <llvm/IR/LLVMContext.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IR/Verifier.h>
 #include <llvm/Support/DynamicLibrary.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/SHA1.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/raw_ostream.h>
 #include <llvm/Transforms/IPO.h>
 #include <llvm/Transforms/IPO/AlwaysInliner.h>
+#include <oneapi/dnnl/dnnl.h>
 #if SC_LLVM_BACKEND >= 16
 #include <llvm/IR/PassManager.h>
 #include <llvm/Passes/PassBuilder.h>
@@ -162,6 +169,74 @@ static void optimize_llvm_module(llvm::TargetMachine *tm, llvm::Module *module,
 std::unique_ptr<llvm::TargetMachine> get_llvm_target_machine(
         llvm::CodeGenOpt::Level optlevel);
 
+// Keeps the objects compiled by MCJIT in the code cache directory, so that
+// other processes compiling identical modules for the same target load them
+// instead of optimizing and compiling the modules again. The file name is the
+// digest of the module before optimization, the target, and the LLVM and
+// library versions, so a module that embeds process-specific addresses never
+// hits the cache.
+class llvm_disk_object_cache_t : public llvm::ObjectCache {
+public:
+    llvm_disk_object_cache_t(llvm::TargetMachine *tm, llvm::Module *module,
+            unsigned opt_level) {
+        const auto &dir = utils::compiler_configs_t::get().code_cache_dir_;
+        if (dir.empty()) { return; }
+        std::string key = dump_module_to_string(module);
+        key += '\n';
+        key += LLVM_VERSION_STRING;
+        key += '\n';
+        key += dnnl_version()->hash;
+        key += '\n';
+        key += tm->getTargetTriple().str();
+        key += '\n';
+        key += tm->getTargetCPU().str();
+        key += '\n';
+        key += tm->getTargetFeatureString().str();
+        key += '\n';
+        key += std::to_string(opt_level);
+        auto digest = llvm::SHA1::hash(llvm::ArrayRef<uint8_t>(
+                reinterpret_cast<const uint8_t *>(key.data()), key.size()));
+        path_ = dir + "/llvm_jit_module-" + llvm::toHex(digest, true) + ".o";
+
+        auto buf = llvm::MemoryBuffer::getFile(path_);
+        if (buf) {
+            obj_ = std::move(*buf);
+            SC_MODULE_INFO << "Loading the compiled module from " << path_;
+        }
+    }
+
+    bool is_enabled() const { return !path_.empty(); }
+    // the module needs not be optimized if the compiled object is loaded
+    bool has_object() const { return obj_ != nullptr; }
+
+    void notifyObjectCompiled(
+            const llvm::Module *, llvm::MemoryBufferRef obj) override {
+        if (!is_enabled() || has_object()) { return; }
+        // write to a unique file first, so that concurrent processes never
+        // see a partially written object
+        std::string tmp_path
+                = path_ + "." + utils::get_unique_name_for_file() + ".tmp";
+        std::ofstream of(tmp_path, std::ios::binary);
+        of.write(obj.getBufferStart(), obj.getBufferSize());
+        of.close();
+        if (!of || rename(tmp_path.c_str(), path_.c_str()) != 0) {
+            SC_MODULE_WARN << "Cannot write the compiled module to " << path_;
+            remove(tmp_path.c_str());
+        }
+    }
+
+    std::unique_ptr<llvm::MemoryBuffer> getObject(
+            const llvm::Module *) override {
+        if (!has_object()) { return nullptr; }
+        return llvm::MemoryBuffer::getMemBufferCopy(
+                obj_->getBuffer(), obj_->getBufferIdentifier());
+    }
+
+private:
+    std::string path_;
+    std::unique_ptr<llvm::MemoryBuffer> obj_;
+};
+
 static void *resolve_llvm_symbol(
         llvm::ExecutionEngine *engine, const std::string &name);
 
@@ -204,7 +279,10 @@ std::shared_ptr<jit_module> llvm_jit::make_jit_module(
 
     llvm::Module *mod_ptr = llvmmod.get();
     auto tm = get_llvm_target_machine(llvm_opt).release();
-    optimize_llvm_module(tm, mod_ptr, llvm_opt);
+    llvm_disk_object_cache_t object_cache {tm, mod_ptr, opt};
+    if (!object_cache.has_object()) {
+        optimize_llvm_module(tm, mod_ptr, llvm_opt);
+    }
     auto engine = llvm::EngineBuilder(std::move(llvmmod))
                           .setErrorStr(&err)
                           .setOptLevel(llvm_opt)
@@ -223,7 +301,9 @@ std::shared_ptr<jit_module> llvm_jit::make_jit_module(
     if (!engine) {
         throw std::runtime_error("LLVM EngineBuilder error: " + err);
     }
+    if (object_cache.is_enabled()) { engine->setObjectCache(&object_cache); }
     engine->finalizeObject();
+    engine->setObjectCache(nullptr);
     typedef void (*init_func_t)(void *ctx, void *mod);
     auto init_func = reinterpret_cast<init_func_t>(
             resolve_llvm_symbol(engine, "__sc_init__"));
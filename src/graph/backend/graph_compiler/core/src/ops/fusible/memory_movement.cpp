@@ -1245,23 +1245,46 @@ void reshape_op_t::compute_block(context_ptr ctx,
     bld->emit(cur.remove_const());
 }
 
-split_op_t::split_op_t(graph_tensor_ptr v, int dim, const sc_dims &shapes)
-    : dim_(dim), shapes_(shapes) {
+split_op_t::split_op_t(const std::vector<graph_tensor_ptr> &ins,
+        const std::vector<graph_tensor_ptr> &outs, const any_map_t &attrs)
+    : dim_(attrs.get<int>("dim")), shapes_(attrs.get<sc_dims>("shapes")) {
+    op_name_ = "split";
+    COMPILE_ASSERT(ins.size() == 1, "Split op expects a single input.");
+    auto &in_dims = ins[0]->details_.get_plain_dims();
+    COMPILE_ASSERT(dim_ < in_dims.size(), "Split dim is not available.");
+    COMPILE_ASSERT(outs.empty() || outs.size() == shapes_.size(),
+            "Split op expects an output per shape.");
+    attrs_ = attrs;
     attrs_.set(op_attr_key::no_fuse, true);
-    info_.inputs_.emplace_back(std::move(v));
+    info_.inputs_ = ins;
+    // the split works on the plain format, where the plain axis is also the
+    // blocking axis
+    auto format = sc_data_format_t::get_plain_by_dims((int)in_dims.size());
     for (unsigned i = 0; i < shapes_.size(); i++) {
-        info_.outputs_.emplace_back(std::make_shared<graph_tensor>(this));
+        if (!outs.empty()) {
+            info_.outputs_.emplace_back(outs[i]);
+            info_.outputs_.back()->producer_owner_ = this;
+            continue;
+        }
+        auto out_dims = in_dims;
+        out_dims[dim_] = shapes_[i];
+        info_.outputs_.emplace_back(std::make_shared<graph_tensor>(
+                this, format, out_dims, ins[0]->details_.dtype_));
     }
 }
 
+split_op_t::split_op_t(graph_tensor_ptr v, int dim, const sc_dims &shapes)
+    : split_op_t({std::move(v)}, {},
+            any_map_t({{"dim", dim}, {"shapes", shapes}})) {}
+
 void split_op_t::query_format(context_ptr ctx,
         std::vector<std::vector<format_stride_pair>> &supported_ins,
         std::vector<std::vector<format_stride_pair>> &supported_outs) {
-    std::vector<std::vector<sc_data_format_t>> in_formats, out_formats;
-    out_formats.reserve(info_.outputs_.size());
-    for (size_t i = 0; i < out_formats.size(); ++i) {
-        out_formats[i].push_back({info_.inputs_[0]->details_.get_format()});
-    }
+    auto format = sc_data_format_t::get_plain_by_dims(
+            (int)info_.inputs_[0]->details_.get_plain_dims().size());
+    std::vector<std::vector<sc_data_format_t>> in_formats(1, {format});
+    std::vector<std::vector<sc_data_format_t>> out_formats(
+            info_.outputs_.size(), {format});
     format_to_dense_format_stride_pair(
             in_formats, out_formats, supported_ins, supported_outs);
 }
@@ -1428,6 +1451,7 @@ OP_REGISTER(transpose_op_t, transpose)
 OP_REGISTER(tensor_view_op_t, tensor_view)
 OP_REGISTER(reshape_op_t, reshape)
 OP_REGISTER(reorder_op_t, reorder)
+OP_REGISTER(split_op_t, split)
 } // namespace gc
 } // namespace graph
 } // namespace impl
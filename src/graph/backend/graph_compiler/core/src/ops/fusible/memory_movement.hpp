@@ -160,7 +160,17 @@ private:
     sc_dims shapes_;
 };
 
-class split_op_t : public movement_op_t {
+/**
+ * Splits the input tensor into several tensors along an axis
+ * Inputs:
+ *  - A single tensor to split
+ * Outputs:
+ *  - The pieces of the input, one per element of shapes
+ * Attrs:
+ *  - dim: int - the plain axis to split along
+ *  - shapes: sc_dims - the sizes of the pieces along the axis
+ * */
+class split_op_t : public movement_op_t, public op_traits::auto_copyable_t {
 public:
     DECLARE_QUERY_AND_COMPUTE();
 
@@ -169,6 +179,8 @@ public:
             std::vector<std::vector<format_stride_pair>> &supported_outs)
             override;
 
+    split_op_t(const std::vector<graph_tensor_ptr> &ins,
+            const std::vector<graph_tensor_ptr> &outs, const any_map_t &attrs);
     split_op_t(graph_tensor_ptr v, int dim, const sc_dims &shapes);
 
 private:
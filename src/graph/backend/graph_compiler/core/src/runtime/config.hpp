@@ -18,6 +18,7 @@
 #define GRAPH_BACKEND_GRAPH_COMPILER_CORE_SRC_RUNTIME_CONFIG_HPP
 #include <stdint.h>
 #include <string>
+#include <vector>
 #include <runtime/generic_val.hpp>
 #include <util/def.hpp>
 
@@ -57,6 +58,12 @@ struct SC_API runtime_config_t {
     trace_mode_t trace_mode_ = OFF;
     bool execution_verbose_ = false;
     bool managed_thread_pool_ = true;
+    // if the managed thread pool runs on its own persistent threads
+    bool native_thread_pool_ = false;
+    // how long the idle persistent threads spin before they park
+    int thread_pool_spin_us_ = 1000;
+    // the cores to pin the persistent threads to, empty for no pinning
+    std::vector<int> thread_pool_cores_;
     int verbose_level_ = 0;
     static runtime_config_t &get() noexcept;
 
@@ -41,6 +41,11 @@ const char *env_names[] = {
         DEF_ENV(C_INCLUDE),
         DEF_ENV(TRACE_INIT_CAP),
         DEF_ENV(MANAGED_THREAD_POOL),
+        DEF_ENV(CODE_CACHE_DIR),
+        DEF_ENV(THREAD_POOL_SPIN_US),
+        DEF_ENV(THREAD_POOL_CORES),
+        DEF_ENV(FUSION_DB),
+        DEF_ENV(SPECIALIZE_HOT_SHAPES),
 };
 
 namespace utils {
@@ -34,6 +34,11 @@ enum key {
     SC_C_INCLUDE,
     SC_TRACE_INIT_CAP,
     SC_MANAGED_THREAD_POOL,
+    SC_CODE_CACHE_DIR,
+    SC_THREAD_POOL_SPIN_US,
+    SC_THREAD_POOL_CORES,
+    SC_FUSION_DB,
+    SC_SPECIALIZE_HOT_SHAPES,
     NUM_KEYS
 };
 } // namespace env_key
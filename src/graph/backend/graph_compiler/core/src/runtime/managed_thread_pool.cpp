@@ -16,9 +16,12 @@
 
 #include <algorithm>
 #include <atomic>
-#ifdef SC_KERNEL_PROFILE
 #include <chrono>
-#endif
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include <immintrin.h>
 #include "config.hpp"
 #include "managed_thread_pool.hpp"
@@ -32,6 +35,11 @@
 #include <util/compiler_macros.hpp>
 #include <util/simple_math.hpp>
 
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 #if SC_CPU_THREADPOOL == SC_THREAD_POOL_CUSTOM
 #include <common/dnnl_thread.hpp>
 #endif
@@ -83,6 +91,160 @@ void thread_manager::thread_pool_state::reset_scoreboard() {
     remaining.store(num_threads - 1, std::memory_order_release);
 }
 
+// Threads that persist between the executions of main functions, so that
+// back-to-back executions do not wait for the threads of the threading runtime
+// to wake up. After an execution the threads spin for the time set in the
+// runtime config and then park until the next one.
+//
+// There is a single pool per process: a pool per thread manager would start a
+// team of spinning workers for every framework thread that executes kernels.
+// The pool runs one team at a time, a main function that finds it busy runs
+// on the threads of the threading runtime instead.
+struct native_thread_pool_t {
+    using body_t = std::function<void(int64_t)>;
+
+    static native_thread_pool_t &get() {
+        static native_thread_pool_t pool;
+        return pool;
+    }
+
+    ~native_thread_pool_t() {
+        {
+            std::lock_guard<std::mutex> guard {lock_};
+            exit_ = true;
+            generation_++;
+        }
+        cv_.notify_all();
+        for (auto &t : workers_) {
+            t.join();
+        }
+    }
+
+    // runs body(0) on the calling thread and body(i) on the i-th worker, and
+    // returns when all of them are done. Returns false without running the
+    // body if another team is running on the pool.
+    bool try_run(int num_threads, const body_t &body) {
+        bool expected = false;
+        if (!busy_.compare_exchange_strong(
+                    expected, true, std::memory_order_acquire)) {
+            return false;
+        }
+        run(num_threads, body);
+        busy_.store(false, std::memory_order_release);
+        return true;
+    }
+
+    int num_workers() {
+        std::lock_guard<std::mutex> guard {lock_};
+        return static_cast<int>(workers_.size());
+    }
+
+private:
+    void run(int num_threads, const body_t &body) {
+        {
+            std::lock_guard<std::mutex> guard {lock_};
+            while ((int)workers_.size() < num_threads - 1) {
+                int tid = static_cast<int>(workers_.size()) + 1;
+                workers_.emplace_back([this, tid]() { worker_loop(tid); });
+            }
+        }
+        body_ = &body;
+        num_threads_ = num_threads;
+        running_.store(
+                static_cast<int>(workers_.size()), std::memory_order_relaxed);
+        bool has_parked;
+        {
+            std::lock_guard<std::mutex> guard {lock_};
+            generation_.fetch_add(1, std::memory_order_release);
+            has_parked = parked_ > 0;
+        }
+        if (has_parked) { cv_.notify_all(); }
+        body(0);
+        while (running_.load(std::memory_order_acquire) != 0) {
+            _mm_pause();
+        }
+    }
+
+    void worker_loop(int tid) {
+        pin_to_core(tid);
+        const auto spin = std::chrono::microseconds(
+                runtime_config_t::get().thread_pool_spin_us_);
+        uint64_t seen = 0;
+        for (;;) {
+            auto spin_end = std::chrono::steady_clock::now() + spin;
+            uint64_t polls = 0;
+            while (generation_.load(std::memory_order_acquire) == seen) {
+                // reading the clock is much slower than a pause
+                if (++polls % 1024 != 0
+                        || std::chrono::steady_clock::now() < spin_end) {
+                    _mm_pause();
+                    continue;
+                }
+                std::unique_lock<std::mutex> guard {lock_};
+                parked_++;
+                cv_.wait(guard, [&]() {
+                    return generation_.load(std::memory_order_relaxed) != seen;
+                });
+                parked_--;
+            }
+            seen = generation_.load(std::memory_order_acquire);
+            if (exit_) { return; }
+            if (tid < num_threads_) { (*body_)(tid); }
+            running_.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    static void pin_to_core(int tid) {
+#ifdef __linux__
+        const auto &cores = runtime_config_t::get().thread_pool_cores_;
+        if (cores.empty()) { return; }
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cores[tid % cores.size()], &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+    }
+
+    std::vector<std::thread> workers_;
+    const body_t *body_ = nullptr;
+    int num_threads_ = 0;
+    std::atomic<uint64_t> generation_ {0};
+    std::atomic<int> running_ {0};
+    std::mutex lock_;
+    std::condition_variable cv_;
+    int parked_ = 0;
+    std::atomic<bool> exit_ {false};
+    std::atomic<bool> busy_ {false};
+};
+
+static int (*base_get_thread_id)() = nullptr;
+static int (*base_is_in_parallel)() = nullptr;
+
+// the threads of the native pool are unknown to the threading runtime, so
+// they are identified by the thread locals set up by the thread manager
+static int get_thread_id_native() {
+    auto &tls = thread_local_buffer_t::tls_buffer_;
+    return tls.in_managed_thread_pool_ ? tls.additional_->linear_thread_id_
+                                       : base_get_thread_id();
+}
+
+static int is_in_parallel_native() {
+    auto &tls = thread_local_buffer_t::tls_buffer_;
+    return tls.in_managed_thread_pool_ ? 1 : base_is_in_parallel();
+}
+
+void thread_manager::use_native_thread_pool(thread_pool_table *table) {
+    if (table->get_thread_id == &get_thread_id_native) { return; }
+    base_get_thread_id = table->get_thread_id;
+    base_is_in_parallel = table->is_in_parallel;
+    table->get_thread_id = &get_thread_id_native;
+    table->is_in_parallel = &is_in_parallel_native;
+}
+
+int thread_manager::get_native_thread_pool_workers() {
+    return native_thread_pool_t::get().num_workers();
+}
+
 #ifdef SC_KERNEL_PROFILE
 static std::atomic<int> instances {0};
 #endif
@@ -169,19 +331,7 @@ void thread_manager::run_main_function(main_func_t f, runtime::stream_t *stream,
         state.execution_flags
                 = gc::runtime::thread_pool_flags::THREAD_POOL_DEFAULT;
 
-#if SC_CPU_THREADPOOL == SC_THREAD_POOL_OMP
-        SC_NO_OP();
-#pragma omp parallel for
-        for (int i = 0; i < threads; i++) {
-            SC_NO_OP();
-#elif SC_CPU_THREADPOOL == SC_THREAD_POOL_TBB
-        oneapi::tbb::task_arena arena(threads);
-        arena.execute([&] {
-            tbb::parallel_for(0, threads, 1, [&](int64_t i) {
-#elif SC_CPU_THREADPOOL == SC_THREAD_POOL_CUSTOM
-        dnnl::impl::parallel(threads, [&](int64_t i, int64_t dummy) {
-            current_active_thr_mgr = this;
-#endif
+        auto run_thread = [&](int64_t i) {
             // use helper func to workaround a icx compiler bug
             auto &tls = get_tls_helper();
             tls.in_managed_thread_pool_ = true;
@@ -203,15 +353,31 @@ void thread_manager::run_main_function(main_func_t f, runtime::stream_t *stream,
             } else {
                 worker_func(this, i);
             }
+        };
+
+        if (!runtime_config_t::get().native_thread_pool_
+                || !native_thread_pool_t::get().try_run(threads, run_thread)) {
 #if SC_CPU_THREADPOOL == SC_THREAD_POOL_OMP
-        }
+            SC_NO_OP();
+#pragma omp parallel for
+            for (int i = 0; i < threads; i++) {
+                SC_NO_OP();
+                run_thread(i);
+            }
 #elif SC_CPU_THREADPOOL == SC_THREAD_POOL_TBB
+            oneapi::tbb::task_arena arena(threads);
+            arena.execute([&] {
+                tbb::parallel_for(0, threads, 1,
+                        [&](int64_t i) { run_thread(i); });
             });
-        });
 #elif SC_CPU_THREADPOOL == SC_THREAD_POOL_CUSTOM
-            current_active_thr_mgr = nullptr;
-        });
+            dnnl::impl::parallel(threads, [&](int64_t i, int64_t dummy) {
+                current_active_thr_mgr = this;
+                run_thread(i);
+                current_active_thr_mgr = nullptr;
+            });
 #endif
+        }
         if (state.execution_flags & thread_pool_flags::THREAD_POOL_EXIT) {
             state.trigger = -1;
             state.execution_flags = 0;
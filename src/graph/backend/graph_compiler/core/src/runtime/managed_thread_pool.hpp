@@ -17,6 +17,7 @@
 #ifndef GRAPH_BACKEND_GRAPH_COMPILER_CORE_SRC_RUNTIME_MANAGED_THREAD_POOL_HPP
 #define GRAPH_BACKEND_GRAPH_COMPILER_CORE_SRC_RUNTIME_MANAGED_THREAD_POOL_HPP
 #include <atomic>
+#include <runtime/config.hpp>
 #include <runtime/context.hpp>
 
 namespace dnnl {
@@ -58,6 +59,13 @@ struct thread_manager {
     void run_main_function(main_func_t f, runtime::stream_t *stream,
             void *mod_data, generic_val *args);
     static thread_local thread_manager cur_mgr;
+
+    // Switches the thread managers to run main functions on the persistent
+    // threads of a process-wide pool instead of the threads of the threading
+    // runtime. Updates the thread id queries in the table accordingly.
+    static void use_native_thread_pool(thread_pool_table *table);
+    // Returns the number of worker threads the native pool has started.
+    static int get_native_thread_pool_workers();
 };
 } // namespace runtime
 } // namespace gc
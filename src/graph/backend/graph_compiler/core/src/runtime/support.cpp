@@ -14,6 +14,7 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <stdint.h>
@@ -24,6 +25,7 @@
 #include <runtime/env_var.hpp>
 #include <runtime/env_vars.hpp>
 #include <runtime/logging.hpp>
+#include <runtime/managed_thread_pool.hpp>
 #include <runtime/managed_thread_pool_exports.hpp>
 #include <runtime/os.hpp>
 #include <runtime/parallel.hpp>
@@ -165,13 +167,29 @@ runtime_config_t::runtime_config_t() {
 #else
             0;
 #endif
-    managed_thread_pool_
-            = (utils::getenv_int(env_names[SC_MANAGED_THREAD_POOL], default_MTP)
-                    != 0);
+    int managed_thread_pool_mode
+            = utils::getenv_int(env_names[SC_MANAGED_THREAD_POOL], default_MTP);
+    managed_thread_pool_ = managed_thread_pool_mode != 0;
 
     if (managed_thread_pool_) {
         thread_pool_table_->parallel_call_managed = &sc_parallel_call_managed;
     }
+#if SC_CPU_THREADPOOL == SC_THREAD_POOL_OMP \
+        || SC_CPU_THREADPOOL == SC_THREAD_POOL_TBB
+    // the native pool is not used with user-provided thread pools
+    native_thread_pool_ = managed_thread_pool_mode == 2;
+#endif
+    if (native_thread_pool_) {
+        thread_pool_spin_us_ = std::max(0,
+                utils::getenv_int(env_names[SC_THREAD_POOL_SPIN_US], 1000));
+        for (auto &core : utils::string_split(
+                     utils::getenv_string(env_names[SC_THREAD_POOL_CORES]),
+                     ",")) {
+            if (core.empty()) { continue; }
+            thread_pool_cores_.push_back(std::stoi(core));
+        }
+        runtime::thread_manager::use_native_thread_pool(thread_pool_table_);
+    }
     trace_initial_cap_ = utils::getenv_int(env_names[SC_TRACE_INIT_CAP], 4096);
     trace_out_path_ = utils::getenv_string(env_names[SC_TRACE]);
     char mode = 0;
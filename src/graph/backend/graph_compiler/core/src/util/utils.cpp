@@ -23,6 +23,7 @@
 #include <dlfcn.h>
 #include <unistd.h>
 #endif
+#include <algorithm>
 #include <atomic>
 #include <fstream>
 #include <stdlib.h>
@@ -143,6 +144,10 @@ static void parse_value(const char *name, T &v) {
 using namespace env_key;
 compiler_configs_t::compiler_configs_t() {
     dump_gen_code_ = utils::getenv_string(env_names[SC_DUMP_GENCODE]);
+    code_cache_dir_ = utils::getenv_string(env_names[SC_CODE_CACHE_DIR]);
+    fusion_db_ = utils::getenv_string(env_names[SC_FUSION_DB]);
+    specialize_hot_shapes_ = std::max(
+            0, utils::getenv_int(env_names[SC_SPECIALIZE_HOT_SHAPES], 0));
     print_pass_result_ = utils::getenv_int(env_names[SC_PRINT_PASS_RESULT], 0);
 
     if (temp_dir_.empty()) {
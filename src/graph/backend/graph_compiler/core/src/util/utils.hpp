@@ -217,6 +217,13 @@ SC_INTERNAL_API int get_nearest_vector_step(int step);
 struct SC_INTERNAL_API compiler_configs_t {
     bool print_gen_code_;
     std::string dump_gen_code_;
+    // the directory to keep compiled code in for use by other processes
+    std::string code_cache_dir_;
+    // the file keeping the fusion policies measured to be the fastest
+    std::string fusion_db_;
+    // the number of executions of a dynamic partition with the same shapes
+    // after which a static kernel is compiled for them, 0 to never compile
+    size_t specialize_hot_shapes_ = 0;
     std::string jit_cc_options_;
     std::vector<std::string> cpu_jit_flags_;
     bool xbyak_jit_save_obj_ = false;
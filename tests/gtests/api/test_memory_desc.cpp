@@ -14,6 +14,8 @@
 * limitations under the License.
 *******************************************************************************/
 
+#include <cstring>
+
 #include "dnnl_test_common.hpp"
 #include "gtest/gtest.h"
 
@@ -88,4 +90,59 @@ HANDLE_EXCEPTIONS_FOR_TEST(memory_desc_test_t, TestComparison) {
     EXPECT_NE(plain_md, blocked_md);
 }
 
+HANDLE_EXCEPTIONS_FOR_TEST(memory_desc_test_t, TestBlob) {
+    auto blocked_md = memory::desc({32, 64, 3, 3}, memory::data_type::f32,
+            memory::format_tag::ABcd16a16b);
+    auto plain_md = memory::desc(
+            {32, 64, 3, 3}, memory::data_type::s8, memory::format_tag::acdb);
+    auto sub_md = plain_md.submemory_desc({16, 64, 3, 3}, {16, 0, 0, 0});
+
+    for (const auto &md : {memory::desc(), blocked_md, plain_md, sub_md}) {
+        auto blob = md.get_blob();
+        EXPECT_FALSE(blob.empty());
+        EXPECT_EQ(memory::desc(blob), md);
+    }
+
+    // Truncated and extended blobs are rejected.
+    auto blob = blocked_md.get_blob();
+    auto truncated = std::vector<uint8_t>(blob.begin(), blob.end() - 1);
+    EXPECT_ANY_THROW(memory::desc {truncated});
+    auto extended = blob;
+    extended.push_back(0);
+    EXPECT_ANY_THROW(memory::desc {extended});
+    EXPECT_ANY_THROW(memory::desc {std::vector<uint8_t>()});
+
+    // Blobs describing what the API would not create are rejected. The
+    // descriptor follows the header: ndims, dims, data_type, padded_dims,
+    // padded_offsets, offset0, format_kind and the blocking desc.
+    const size_t header_size = memory::desc().get_blob().size()
+            - sizeof(int) - sizeof(dnnl_data_type_t) - sizeof(memory::dim)
+            - sizeof(dnnl_format_kind_t);
+    const size_t ndims = 4, dims_size = ndims * sizeof(memory::dim);
+    const size_t ndims_off = header_size;
+    const size_t dt_off = ndims_off + sizeof(int) + dims_size;
+    const size_t fmt_kind_off = dt_off + sizeof(dnnl_data_type_t)
+            + 2 * dims_size + sizeof(memory::dim);
+    const size_t inner_idxs_off = fmt_kind_off + sizeof(dnnl_format_kind_t)
+            + dims_size + sizeof(int) + 2 * sizeof(memory::dim);
+    auto corrupt = [&](size_t off, int value) {
+        auto corrupted = blob;
+        std::memcpy(corrupted.data() + off, &value, sizeof(value));
+        return corrupted;
+    };
+    ASSERT_EQ(memory::desc(corrupt(ndims_off, (int)ndims)), blocked_md);
+    ASSERT_EQ(memory::desc(corrupt(dt_off, dnnl_f32)), blocked_md);
+    ASSERT_EQ(memory::desc(corrupt(fmt_kind_off, dnnl_blocked)), blocked_md);
+    ASSERT_EQ(memory::desc(corrupt(inner_idxs_off, 0)), blocked_md);
+
+    EXPECT_ANY_THROW(memory::desc {corrupt(ndims_off, -1)});
+    EXPECT_ANY_THROW(memory::desc {corrupt(ndims_off, DNNL_MAX_NDIMS + 1)});
+    EXPECT_ANY_THROW(memory::desc {corrupt(dt_off, dnnl_data_type_undef)});
+    EXPECT_ANY_THROW(memory::desc {corrupt(dt_off, 1000)});
+    EXPECT_ANY_THROW(
+            memory::desc {corrupt(fmt_kind_off, dnnl_format_kind_undef)});
+    EXPECT_ANY_THROW(memory::desc {corrupt(fmt_kind_off, 1000)});
+    EXPECT_ANY_THROW(memory::desc {corrupt(inner_idxs_off, (int)ndims)});
+}
+
 } // namespace dnnl
@@ -13,7 +13,10 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  *******************************************************************************/
+#include <cstdio>
+#include <fstream>
 #include <iostream>
+#include <string>
 #include <utility>
 #include "context.hpp"
 #include "test_graph.hpp"
@@ -23,6 +26,7 @@
 #include <compiler/ir/graph/pass/pass.hpp>
 #include <compiler/jit/compiler_driver.hpp>
 #include <unordered_set>
+#include <util/utils.hpp>
 
 using namespace dnnl::impl::graph::gc;
 
@@ -137,3 +141,72 @@ TEST(GCCore_CPU_compiler_driver, TestCodeReuse) {
     mod1 = nullptr;
     EXPECT_EQ(query_cached_code_of_context(ctx), 0UL);
 }
+
+static sc_graph_t make_eltwise_graph(int rows) {
+    sc_graph_t g;
+    auto in1 = g.make_input({graph_tensor::make({rows, 64})});
+    auto in2 = g.make_input({graph_tensor::make({rows, 64})});
+    // a removed op makes the ids of the ops differ from their positions in
+    // the copy of the graph
+    g.make("relu", in1->get_outputs(), {}, {})->remove();
+    auto add = g.make(
+            "add", {in1->get_outputs()[0], in2->get_outputs()[0]}, {}, {});
+    auto relu = g.make("relu", add->get_outputs(), {}, {});
+    g.make_output(relu->get_outputs());
+    return g;
+}
+
+static size_t count_lines(const std::string &path) {
+    std::ifstream in(path);
+    std::string line;
+    size_t ret = 0;
+    while (std::getline(in, line)) {
+        ret++;
+    }
+    return ret;
+}
+
+TEST(GCCore_CPU_compiler_driver, TestTuneFusionPolicy) {
+    auto &cfg = utils::compiler_configs_t::get();
+    auto old_db = cfg.fusion_db_;
+    const std::string path = "gc_test_fusion_policy.db";
+    std::remove(path.c_str());
+    cfg.fusion_db_ = path;
+    auto ctx = get_test_ctx();
+
+    sc_graph_t g = make_eltwise_graph(32);
+    auto args = g.get_input_ops();
+    args.emplace_back(g.get_output_ops()[0]);
+    // the fastest policy is measured and recorded
+    auto tuned = tune_fusion_policy(ctx, g, args);
+    EXPECT_NE(tuned, ctx);
+    EXPECT_EQ(count_lines(path), 1UL);
+    // the recorded policy is reused without measuring
+    auto tuned2 = tune_fusion_policy(ctx, g, args);
+    EXPECT_EQ(tuned2->flags_.mixed_fusion_, tuned->flags_.mixed_fusion_);
+    EXPECT_EQ(tuned2->flags_.use_cost_model_, tuned->flags_.use_cost_model_);
+    EXPECT_EQ(count_lines(path), 1UL);
+
+    // the tuned graph computes the same results
+    auto f = compiler_driver(ctx, g, args);
+    std::vector<float> a(32 * 64), b(32 * 64), out(32 * 64);
+    uint32_t seed = 0;
+    test_utils::rand_fill_stable(a.data(), a.size(), seed);
+    test_utils::rand_fill_stable(b.data(), b.size(), seed);
+    f->call_default(a.data(), b.data(), out.data());
+    std::vector<float> ref(out.size());
+    for (size_t i = 0; i < ref.size(); i++) {
+        ref[i] = std::max(a[i] + b[i], 0.f);
+    }
+    test_utils::compare_data(out, ref, 1e-5f, 1e-5f);
+
+    // the args of another graph make every policy fail, and the untuned
+    // context is used without recording anything
+    sc_graph_t g2 = make_eltwise_graph(48);
+    auto failed = tune_fusion_policy(ctx, g2, args);
+    EXPECT_EQ(failed, ctx);
+    EXPECT_EQ(count_lines(path), 1UL);
+
+    cfg.fusion_db_ = old_db;
+    std::remove(path.c_str());
+}
@@ -23,9 +23,12 @@
 #include <compiler/ir/graph/pass/pass.hpp>
 #include <compiler/ir/graph/transform/transform.hpp>
 #include <compiler/jit/jit.hpp>
+#include <runtime/config.hpp>
 #include <util/any_map.hpp>
 
+#include <algorithm>
 #include <iostream>
+#include "context.hpp"
 #include "exception_util.hpp"
 #include "gtest/gtest.h"
 
@@ -96,3 +99,127 @@ TEST(GCCore_CPU_graph_horizontal_merge_cpp, TestGraphHorizontalMerge) {
     EXPECT_NO_FATAL_FAILURE(
             jit_engine_t::make(get_default_context())->get_entry_func(f));
 }
+
+TEST(GCCore_CPU_graph_horizontal_merge_cpp, TestHorizontalMatmulMerge) {
+    thread_num_reset reseter;
+    if (!runtime_config_t::get().set_num_threads(16)) { GTEST_SKIP(); }
+    auto make_graph = [](bool const_weights) {
+        sc_graph_t graph;
+        auto input = graph.make_input({graph_tensor::make({64, 256})});
+        for (sc_dim n : {64, 64, 128}) {
+            auto weight = graph.make_input({graph_tensor::make({256, n})});
+            if (const_weights) {
+                weight->attrs_.set("constant", const_kind::local_const);
+            }
+            auto matmul = graph.make("matmul",
+                    {input->get_outputs()[0], weight->get_outputs()[0]}, {},
+                    {});
+            graph.make_output(matmul->get_outputs());
+        }
+        return graph;
+    };
+    auto count_ops = [](const sc_graph_t &graph, const std::string &name) {
+        return std::count_if(graph.ops_.begin(), graph.ops_.end(),
+                [&](const sc_op_ptr &op) {
+                    return !op->is_removed_ && op->op_name_ == name;
+                });
+    };
+
+    sc_graph_t graph = make_graph(true);
+    horizontal_matmul_merge(graph);
+    EXPECT_EQ(count_ops(graph, "matmul"), 1);
+    EXPECT_EQ(count_ops(graph, "concat"), 1);
+    ASSERT_EQ(count_ops(graph, "split"), 1);
+    auto outs = graph.get_output_ops();
+    ASSERT_EQ(outs.size(), 3UL);
+    const sc_dims expected_n = {64, 64, 128};
+    for (size_t i = 0; i < outs.size(); i++) {
+        auto &out = outs[i]->get_inputs()[0];
+        EXPECT_EQ(out->producer_owner_->op_name_, "split");
+        EXPECT_EQ(out->details_.get_plain_dims(), sc_dims({64, expected_n[i]}));
+    }
+
+    // weights that are not constant would be concatenated on every run
+    graph = make_graph(false);
+    horizontal_matmul_merge(graph);
+    EXPECT_EQ(count_ops(graph, "matmul"), 3);
+    EXPECT_EQ(count_ops(graph, "split"), 0);
+}
+
+TEST(GCCore_CPU_graph_horizontal_merge_cpp, TestHorizontalMatmulMergeExec) {
+    REQUIRE_AVX2();
+    thread_num_reset reseter;
+    if (!runtime_config_t::get().set_num_threads(16)) { GTEST_SKIP(); }
+    auto ctx = std::make_shared<context_t>(*get_test_ctx());
+    ctx->flags_.mixed_fusion_ = true;
+    const sc_dim M = 64, K = 96;
+    const sc_dims Ns = {32, 48, 64};
+
+    auto make_graph = [&](sc_graph_t &graph, std::vector<sc_op_ptr> &args) {
+        auto input = graph.make_input({graph_tensor::make({M, K})});
+        args.emplace_back(input);
+        std::vector<sc_op_ptr> outs;
+        for (sc_dim n : Ns) {
+            auto weight = graph.make_input({graph_tensor::make({K, n})});
+            weight->attrs_.set("constant", const_kind::local_const);
+            args.emplace_back(weight);
+            auto matmul = graph.make("matmul",
+                    {input->get_outputs()[0], weight->get_outputs()[0]}, {},
+                    {});
+            outs.emplace_back(graph.make_output(matmul->get_outputs()));
+        }
+        args.insert(args.end(), outs.begin(), outs.end());
+    };
+
+    // the graph is merged by the default passes
+    sc_graph_t merged;
+    std::vector<sc_op_ptr> merged_args;
+    make_graph(merged, merged_args);
+    horizontal_matmul_merge(merged);
+    ASSERT_EQ(std::count_if(merged.ops_.begin(), merged.ops_.end(),
+                      [](const sc_op_ptr &op) {
+                          return !op->is_removed_ && op->op_name_ == "split";
+                      }),
+            1);
+
+    sc_graph_t graph;
+    std::vector<sc_op_ptr> args;
+    make_graph(graph, args);
+    graph_driver(graph, ctx);
+    auto ir_mod = lower_graph(ctx, graph, args);
+    auto fptr = jit_engine_t::make(ctx)->get_entry_func(ir_mod);
+
+    std::vector<float> input_data(M * K);
+    test_utils::fill_data(&input_data[0], M * K);
+    std::vector<std::vector<float>> weight_data, out_data;
+    for (sc_dim n : Ns) {
+        weight_data.emplace_back(K * n);
+        test_utils::fill_data(&weight_data.back()[0], K * n);
+        out_data.emplace_back(M * n);
+    }
+    std::vector<generic_val> generic_args;
+    generic_args.emplace_back(&input_data[0]);
+    for (auto &w : weight_data) {
+        generic_args.emplace_back(&w[0]);
+    }
+    for (auto &o : out_data) {
+        generic_args.emplace_back(&o[0]);
+    }
+    // the second run uses the folded constant weights
+    for (int run = 0; run < 2; run++) {
+        fptr->call_generic_default(generic_args.data());
+        for (size_t i = 0; i < Ns.size(); i++) {
+            const sc_dim N = Ns[i];
+            std::vector<float> ref(M * N, 0.f);
+            for (sc_dim m = 0; m < M; m++) {
+                for (sc_dim k = 0; k < K; k++) {
+                    for (sc_dim n = 0; n < N; n++) {
+                        ref[m * N + n] += input_data[m * K + k]
+                                * weight_data[i][k * N + n];
+                    }
+                }
+            }
+            test_utils::compare_data(out_data[i], ref, 1e-4f, 1e-5f);
+        }
+    }
+}
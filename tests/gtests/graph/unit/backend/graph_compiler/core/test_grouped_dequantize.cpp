@@ -0,0 +1,93 @@
+/*******************************************************************************
+ * Copyright 2023 Intel Corporation
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *******************************************************************************/
+
+#include <vector>
+#include "context.hpp"
+#include "exception_util.hpp"
+#include "test_utils.hpp"
+#include "gtest/gtest.h"
+#include <compiler/ir/graph/driver.hpp>
+#include <compiler/ir/graph/graph.hpp>
+#include <compiler/ir/graph/lowering.hpp>
+#include <compiler/jit/jit.hpp>
+
+using namespace dnnl::impl::graph::gc;
+
+// weight-only quantized matmul: f32 data by s8 weight with a scale and zero
+// point per group of K elements of each output channel
+TEST(GCCore_CPU_grouped_dequantize_cpp, TestWeightOnlyQuantizedMatmul) {
+    REQUIRE_AVX2();
+    const sc_dim M = 16, K = 64, N = 32, group_size = 16;
+    const sc_dim num_groups = K / group_size;
+    auto ctx = get_test_ctx();
+
+    sc_graph_t graph;
+    auto data = graph.make_input({graph_tensor::make({M, K})});
+    auto weight = graph.make_input({graph_tensor::make(
+            {K, N}, sc_data_format_t(), datatypes::s8)});
+    std::vector<float> scales(num_groups * N);
+    std::vector<int> zero_points(num_groups * N);
+    for (size_t i = 0; i < scales.size(); i++) {
+        scales[i] = 0.01f * static_cast<float>(i % 7 + 1);
+        zero_points[i] = static_cast<int>(i % 5) - 2;
+    }
+    auto deq = graph.make("dequantize", weight->get_outputs(), {},
+            {{"dtype", datatypes::f32}, {"scales", scales},
+                    {"zero_points", zero_points}, {"group_size", 16},
+                    {"group_axis", 0}});
+    auto matmul = graph.make("matmul",
+            {data->get_outputs()[0], deq->get_outputs()[0]}, {}, {});
+    auto out = graph.make_output(matmul->get_outputs());
+    graph_driver(graph, ctx);
+
+    std::vector<float> data_buf(M * K), out_buf(M * N), ref(M * N, 0.f);
+    std::vector<int8_t> weight_buf(K * N);
+    test_utils::fill_data(data_buf.data(), data_buf.size());
+    for (size_t i = 0; i < weight_buf.size(); i++) {
+        weight_buf[i] = static_cast<int8_t>(static_cast<int>(i % 17) - 8);
+    }
+    auto ir_mod = lower_graph(ctx, graph, {data, weight, out});
+    auto fptr = jit_engine_t::make(ctx)->get_entry_func(ir_mod);
+    fptr->call_default(data_buf.data(), weight_buf.data(), out_buf.data());
+
+    for (sc_dim m = 0; m < M; m++) {
+        for (sc_dim k = 0; k < K; k++) {
+            for (sc_dim n = 0; n < N; n++) {
+                const sc_dim q = (k / group_size) * N + n;
+                const float w = scales[q]
+                        * static_cast<float>(
+                                weight_buf[k * N + n] - zero_points[q]);
+                ref[m * N + n] += data_buf[m * K + k] * w;
+            }
+        }
+    }
+    test_utils::compare_data(out_buf, ref, 1e-4f, 1e-4f);
+}
+
+TEST(GCCore_CPU_grouped_dequantize_cpp, TestBadGroupSize) {
+    sc_graph_t graph;
+    auto weight = graph.make_input({graph_tensor::make(
+            {60, 32}, sc_data_format_t(), datatypes::s8)});
+    auto deq = graph.make("dequantize", weight->get_outputs(), {},
+            {{"dtype", datatypes::f32},
+                    {"scales", std::vector<float>(4 * 32, 1.f)},
+                    {"zero_points", std::vector<int> {0}},
+                    {"group_size", 16}, {"group_axis", 0}});
+    graph.make_output(deq->get_outputs());
+    EXPECT_SC_ERROR(graph_driver(graph, get_test_ctx()),
+            "Dequantize expects the group axis to be divisible by the group "
+            "size");
+}
@@ -14,10 +14,12 @@
  * limitations under the License.
  *******************************************************************************/
 
+#include <algorithm>
 #include <atomic>
 #include <iostream>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 #include "gtest/gtest.h"
 #include <runtime/barrier.hpp>
 #include <runtime/config.hpp>
@@ -173,4 +175,56 @@ TEST(GCCore_CPU_thread_pool, TestThreadNum) {
         ASSERT_EQ(v, 2);
     }
 }
+
+TEST(GCCore_CPU_thread_pool, TestNativeThreadPoolIsShared) {
+    dnnl_thread_env();
+    auto &cfg = runtime_config_t::get();
+    int nthreads = cfg.thread_pool_table_->get_num_threads();
+    bool old_native = cfg.native_thread_pool_;
+    cfg.native_thread_pool_ = true;
+    runtime::thread_manager::use_native_thread_pool(cfg.thread_pool_table_);
+
+    auto funct = [](runtime::stream_t *s, void *mod_data,
+                         generic_val *args) noexcept {
+        int nthreads
+                = runtime_config_t::get().thread_pool_table_->get_num_threads();
+        runtime_config_t::get().thread_pool_table_->parallel_call_managed(
+                [](void *a, void *mod_data, int64_t idx, generic_val *args) {
+                    auto &v = *(std::vector<std::atomic<int>> *)mod_data;
+                    v.at(idx)++;
+                },
+                0, nullptr, mod_data, 0, nthreads * 16, 1, nullptr);
+    };
+
+    // Framework threads executing kernels at the same time share the pool
+    // or fall back to the threading runtime, and never start their own
+    // teams of workers.
+    constexpr int num_callers = 4;
+    std::vector<std::vector<std::atomic<int>>> results;
+    results.reserve(num_callers);
+    for (int i = 0; i < num_callers; i++) {
+        results.emplace_back(nthreads * 16);
+    }
+    std::vector<std::thread> callers;
+    for (int i = 0; i < num_callers; i++) {
+        callers.emplace_back([&funct, &results, i]() {
+            for (int iter = 0; iter < 10; iter++) {
+                runtime::thread_manager::cur_mgr.run_main_function(
+                        funct, nullptr, &results[i], nullptr);
+            }
+        });
+    }
+    for (auto &t : callers) {
+        t.join();
+    }
+    cfg.native_thread_pool_ = old_native;
+
+    for (auto &v : results) {
+        for (auto &count : v) {
+            ASSERT_EQ(count.load(), 10);
+        }
+    }
+    EXPECT_LE(runtime::thread_manager::get_native_thread_pool_workers(),
+            std::max(nthreads - 1, 0));
+}
 #endif
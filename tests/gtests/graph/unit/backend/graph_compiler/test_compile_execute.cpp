@@ -14,6 +14,7 @@
 * limitations under the License.
 *******************************************************************************/
 #include "backend/graph_compiler/compiler_backend.hpp"
+#include "backend/graph_compiler/compiler_partition_impl.hpp"
 #include "interface/allocator.hpp"
 #include "interface/graph.hpp"
 #include "interface/partition.hpp"
@@ -21,8 +22,12 @@
 #include "graph/unit/unit_test_common.hpp"
 #include "test_utils.hpp"
 
+#include <chrono>
+#include <map>
+#include <thread>
 #include <gtest/gtest.h>
 #include <runtime/context.hpp>
+#include <util/utils.hpp>
 
 #if SC_CPU_THREADPOOL == SC_THREAD_POOL_CUSTOM
 struct gc_env_initializer {
@@ -1265,3 +1270,129 @@ TEST(GCGraphTest, LlamaInt8Bf16Concat_CPU) {
     // should hit add_typecast_concat_typecasts_quant pattern
     compile_execution_pipeline(agraph, 1);
 }
+
+TEST(GCGraphTest, ShapeSpecializationKey_CPU) {
+    REQUIRE_CPU_ENGINE();
+    using impl::compiler_impl::shape_specializations_t;
+    impl::engine_t &eng = *get_engine();
+    auto plain = utils::logical_tensor_init(
+            0, {8, 16}, {16, 1}, impl::data_type::f32);
+    auto transposed = utils::logical_tensor_init(
+            0, {8, 16}, {1, 8}, impl::data_type::f32);
+    auto out = utils::logical_tensor_init(1, {8, 32}, impl::data_type::f32);
+    std::vector<impl::tensor_t> plain_ins {impl::tensor_t(plain, &eng, nullptr)};
+    std::vector<impl::tensor_t> transposed_ins {
+            impl::tensor_t(transposed, &eng, nullptr)};
+    std::vector<impl::tensor_t> outs {impl::tensor_t(out, &eng, nullptr)};
+    // the same shapes with other strides need another static kernel
+    EXPECT_EQ(shape_specializations_t::make_key(plain_ins, outs),
+            shape_specializations_t::make_key(plain_ins, outs));
+    EXPECT_NE(shape_specializations_t::make_key(plain_ins, outs),
+            shape_specializations_t::make_key(transposed_ins, outs));
+    // and so do the same shapes given to other tensors
+    EXPECT_NE(shape_specializations_t::make_key(plain_ins, outs),
+            shape_specializations_t::make_key(outs, plain_ins));
+}
+
+TEST(GCGraphTest, SpecializeHotShapes_CPU) {
+    REQUIRE_AVX512();
+    REQUIRE_AMX();
+    REQUIRE_CPU_ENGINE();
+    auto &cfg = dnnl::impl::graph::gc::utils::compiler_configs_t::get();
+    const size_t old_hot_hits = cfg.specialize_hot_shapes_;
+    cfg.specialize_hot_shapes_ = 1;
+    // the mlp pattern takes at least two layers
+    const impl::dim_t K = 32, N = 16;
+    impl::graph_t agraph(engine->kind());
+    compiler_utils::add_mlp_subgraph(&agraph, false, -1, 2, {K, N, N},
+            {impl::op_kind::ReLU, impl::op_kind::ReLU});
+    agraph.finalize();
+
+    auto &compiler_backend_ptr
+            = impl::compiler_impl::compiler_backend_t::get_singleton();
+    compiler_backend_ptr.get_partitions(agraph, impl::partition_policy::fusion);
+    auto partitions = agraph.get_partitions();
+    ASSERT_EQ(partitions.size(), 1U);
+    impl::partition_t p;
+    p.init(partitions[0]);
+    auto partition_inputs = p.get_inputs();
+    auto partition_outputs = p.get_outputs();
+    std::vector<const impl::logical_tensor_t *> inputs;
+    std::vector<const impl::logical_tensor_t *> outputs;
+    for (auto &lt : partition_inputs) {
+        inputs.push_back(&lt);
+    }
+    for (auto &lt : partition_outputs) {
+        outputs.push_back(&lt);
+    }
+    impl::compiled_partition_t cp(p);
+    impl::engine_t &eng = *get_engine();
+    ASSERT_EQ(p.compile(&cp, inputs, outputs, &eng), impl::status::success);
+    impl::logical_tensor_t compiled_output;
+    cp.query_logical_tensor(partition_outputs[0].id, &compiled_output);
+
+    // the weights and the biases of the layers, keyed by the ids given by
+    // add_mlp_subgraph
+    test::vector<float> wei0(K * N), bias0(N), wei1(N * N), bias1(N);
+    for (impl::dim_t i = 0; i < K * N; ++i) {
+        wei0[i] = static_cast<float>(i % 7) * 0.125f - 0.375f;
+    }
+    for (impl::dim_t i = 0; i < N * N; ++i) {
+        wei1[i] = static_cast<float>(i % 5) * 0.125f - 0.25f;
+    }
+    for (impl::dim_t i = 0; i < N; ++i) {
+        bias0[i] = static_cast<float>(i % 3) * 0.5f - 0.5f;
+        bias1[i] = static_cast<float>(i % 4) * 0.25f - 0.25f;
+    }
+    const std::map<size_t, float *> constants {{1, wei0.data()},
+            {2, bias0.data()}, {6, wei1.data()}, {7, bias1.data()}};
+    impl::stream_t &strm = *get_stream();
+    // executions with two sets of shapes and strides alternate, the static
+    // kernel of each set is used once it has been compiled
+    const impl::dim_t batches[] = {8, 24};
+    for (int iter = 0; iter < 20; ++iter) {
+        const impl::dim_t M = batches[iter % 2];
+        test::vector<float> src(M * K), dst(M * N);
+        for (impl::dim_t i = 0; i < M * K; ++i) {
+            src[i] = static_cast<float>((i + iter) % 5) * 0.25f - 0.5f;
+        }
+        std::vector<impl::tensor_t> execution_inputs;
+        for (auto lt : partition_inputs) {
+            void *data = src.data();
+            if (lt.id == 0) {
+                lt.dims[0] = M;
+            } else {
+                ASSERT_EQ(constants.count(lt.id), 1U);
+                data = constants.at(lt.id);
+            }
+            execution_inputs.emplace_back(lt, &eng, data);
+        }
+        auto out_lt = compiled_output;
+        out_lt.dims[0] = M;
+        std::vector<impl::tensor_t> execution_outputs {
+                impl::tensor_t(out_lt, &eng, dst.data())};
+        ASSERT_EQ(cp.execute(&strm, execution_inputs, execution_outputs),
+                impl::status::success);
+        strm.wait();
+        for (impl::dim_t m = 0; m < M; ++m) {
+            std::vector<float> hidden(N);
+            for (impl::dim_t n = 0; n < N; ++n) {
+                float ref = bias0[n];
+                for (impl::dim_t k = 0; k < K; ++k) {
+                    ref += src[m * K + k] * wei0[k * N + n];
+                }
+                hidden[n] = std::max(ref, 0.f);
+            }
+            for (impl::dim_t n = 0; n < N; ++n) {
+                float ref = bias1[n];
+                for (impl::dim_t k = 0; k < N; ++k) {
+                    ref += hidden[k] * wei1[k * N + n];
+                }
+                ref = std::max(ref, 0.f);
+                ASSERT_NEAR(dst[m * N + n], ref, 1e-4f);
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    cfg.specialize_hot_shapes_ = old_hot_hits;
+}
@@ -19,6 +19,7 @@
 
 #include "dnnl.hpp"
 
+#include "common/compact_memory_desc.hpp"
 #include "common/primitive_attr.hpp"
 #include "common/type_helpers.hpp"
 
@@ -167,4 +168,31 @@ TEST(comparison_operators_t, TestSumDesc) {
     TEST_SELF_COMPARISON(sum_desc);
 }
 
+TEST(comparison_operators_t, TestCompactMemoryDesc) {
+    using dnnl::impl::compact_md_t;
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    const memory::desc mds[] = {
+            memory::desc(),
+            memory::desc({2, 16, 1, 1}, dt::f32, tag::nchw),
+            memory::desc({2, 16, 1, 1}, dt::f32, tag::nhwc),
+            memory::desc({2, 16, 3, 3}, dt::f32, tag::nchw),
+            memory::desc({2, 16, 3, 3}, dt::f32, tag::nhwc),
+            memory::desc({2, 16, 3, 3}, dt::f32, tag::nChw16c),
+            memory::desc({2, 16, 3, 3}, dt::s8, tag::nChw16c),
+            memory::desc({2, 16, 3, 3}, dt::f32, tag::nChw8c),
+            memory::desc({2, 16, 3}, dt::f32, tag::abc),
+    };
+
+    for (const auto &lhs : mds) {
+        for (const auto &rhs : mds) {
+            const bool equal = *lhs.get() == *rhs.get();
+            const compact_md_t lhs_compact(*lhs.get()), rhs_compact(*rhs.get());
+            ASSERT_EQ(lhs_compact == rhs_compact, equal);
+            if (equal) ASSERT_EQ(lhs_compact.hash(), rhs_compact.hash());
+        }
+    }
+}
+
 } // namespace dnnl
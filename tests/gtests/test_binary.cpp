@@ -279,6 +279,69 @@ INSTANTIATE_TEST_SUITE_P(BinaryTensorDims, binary_attr_test_t,
                         memory::dims {1, 1024, 1, 1},
                         memory::format_tag::abcd)));
 
+// The padded area of the destination has to stay zero across executions,
+// including the ones where it is known to be clean and is not zeroed again,
+// and once the user writes to it through a mapped pointer or a new handle.
+HANDLE_EXCEPTIONS_FOR_TEST(binary_zero_padding_test_t, TestPaddedAreaIsZero) {
+    engine e = get_test_engine();
+    stream s = make_stream(e);
+
+    const memory::dim C = 3, blk = 16;
+    const memory::desc md({2, C, 4, 5}, memory::data_type::f32,
+            memory::format_tag::nChw16c);
+
+    post_ops ops;
+    ops.append_eltwise(algorithm::eltwise_linear, 2.f, 1.f);
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+    auto pd = binary::primitive_desc(
+            e, algorithm::binary_add, md, md, md, attr);
+    auto prim = binary(pd);
+
+    memory src0(md, e), src1(md, e), dst(md, e);
+    const memory::dim size = md.get_size() / sizeof(float);
+    auto fill = [&](const memory &mem, float real, float pad) {
+        auto ptr = map_memory<float>(mem);
+        for (memory::dim i = 0; i < size; i++)
+            ptr[i] = i % blk < C ? real : pad;
+    };
+    auto check = [&](const memory &mem) {
+        auto ptr = map_memory<float>(mem);
+        for (memory::dim i = 0; i < size; i++)
+            ASSERT_EQ(ptr[i], i % blk < C ? 7.f : 0.f) << "i = " << i;
+    };
+    auto execute = [&]() {
+        prim.execute(s,
+                {{DNNL_ARG_SRC_0, src0}, {DNNL_ARG_SRC_1, src1},
+                        {DNNL_ARG_DST, dst}});
+    };
+
+    fill(src0, 1.f, 0.f);
+    fill(src1, 2.f, 0.f);
+    fill(dst, 42.f, 42.f);
+
+    // Two executions in a row: the second one may skip zeroing.
+    execute();
+    execute();
+    s.wait();
+    check(dst);
+
+    // Mapping the memory lets the user write to the padded area.
+    fill(dst, 42.f, 42.f);
+    execute();
+    s.wait();
+    check(dst);
+
+    // So does switching to another buffer.
+    memory other(md, e);
+    fill(other, 42.f, 42.f);
+    execute();
+    dst.set_data_handle(other.get_data_handle());
+    execute();
+    s.wait();
+    check(dst);
+}
+
 static auto expected_failures = []() {
     return ::testing::Values(
             // test tag::any support
@@ -0,0 +1,255 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct bwd_w_accumulation_params_t {
+    primitive::kind kind;
+    dt src_dt;
+    dt diff_wei_dt;
+    bool with_bias;
+    memory::dims src_dims;
+    memory::dims wei_dims;
+    memory::dims dst_dims;
+};
+
+// Checks that backward by weights with a sum post-op adds the gradients to
+// the contents of diff_weights and diff_bias: the result must match the
+// initial values plus the gradients computed without the post-op.
+class bwd_w_accumulation_test_t
+    : public ::testing::TestWithParam<bwd_w_accumulation_params_t> {
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<decltype(p)>::GetParam();
+        SKIP_IF(unsupported_data_type(p.src_dt)
+                        || unsupported_data_type(p.diff_wei_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Accumulation into gradients is supported on CPU only.");
+        catch_expected_failures(
+                [&]() { Test(); }, false, dnnl_success);
+    }
+
+    primitive_desc make_pd(const primitive_attr &attr) const {
+        auto src_md = memory::desc(p.src_dims, p.src_dt, tag::any);
+        auto wei_md = memory::desc(p.wei_dims, p.diff_wei_dt, tag::any);
+        auto dst_md = memory::desc(p.dst_dims, p.src_dt, tag::any);
+        auto bia_md = p.with_bias
+                ? memory::desc({p.dst_dims[1]}, dt::f32, tag::x)
+                : memory::desc();
+        // The forward hint only provides the formats, and forward does not
+        // support low precision data with f32 weights.
+        auto hint_wei_md = memory::desc(p.wei_dims, p.src_dt, tag::any);
+        const auto &eng = get_test_engine();
+
+        if (p.kind == primitive::kind::inner_product) {
+            auto hint = inner_product_forward::primitive_desc(eng,
+                    prop_kind::forward_training, src_md, hint_wei_md, bia_md,
+                    dst_md);
+            return inner_product_backward_weights::primitive_desc(eng, src_md,
+                    wei_md, bia_md, dst_md, hint, attr);
+        }
+
+        const memory::dims strides = {1, 1}, padding = {1, 1};
+        auto hint = convolution_forward::primitive_desc(eng,
+                prop_kind::forward_training, algorithm::convolution_direct,
+                src_md, hint_wei_md, bia_md, dst_md, strides, padding,
+                padding);
+        return convolution_backward_weights::primitive_desc(eng,
+                algorithm::convolution_direct, src_md, wei_md, bia_md, dst_md,
+                strides, padding, padding, hint, attr);
+    }
+
+    // Returns a memory in the layout of `md` holding the values of `plain`.
+    memory to_md(memory plain, const memory::desc &md) {
+        memory mem(md, get_test_engine());
+        reorder(plain, mem).execute(strm, plain, mem);
+        strm.wait();
+        return mem;
+    }
+
+    std::vector<float> to_f32(
+            memory mem, const memory::dims &dims, tag plain_tag) {
+        memory plain({dims, dt::f32, plain_tag}, get_test_engine());
+        reorder(mem, plain).execute(strm, mem, plain);
+        strm.wait();
+        memory::dim nelems = 1;
+        for (auto d : dims)
+            nelems *= d;
+        auto ptr = map_memory<float>(plain);
+        std::vector<float> v(nelems);
+        for (memory::dim i = 0; i < nelems; ++i)
+            v[i] = ptr[i];
+        return v;
+    }
+
+    std::vector<float> execute(const primitive_desc &pd,
+            const memory &src_plain, const memory &dst_plain,
+            const memory &wei_plain, const memory &bia_plain,
+            std::vector<float> &bias) {
+        const int ndims = (int)p.src_dims.size();
+        const tag wei_tag = ndims == 2 ? tag::ab : tag::abcd;
+
+        auto src = to_md(src_plain, pd.src_desc());
+        auto diff_dst = to_md(dst_plain, pd.diff_dst_desc());
+        auto diff_wei = to_md(wei_plain, pd.diff_weights_desc());
+        memory diff_bia;
+        if (p.with_bias) diff_bia = to_md(bia_plain, pd.diff_weights_desc(1));
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_DIFF_DST, diff_dst},
+                {DNNL_ARG_DIFF_WEIGHTS, diff_wei}};
+        if (p.with_bias) args.insert({DNNL_ARG_DIFF_BIAS, diff_bia});
+        primitive(pd).execute(strm, args);
+        strm.wait();
+
+        if (p.with_bias) bias = to_f32(diff_bia, {p.dst_dims[1]}, tag::x);
+        return to_f32(diff_wei, p.wei_dims, wei_tag);
+    }
+
+    void Test() {
+        const auto &eng = get_test_engine();
+        strm = make_stream(eng);
+
+        const int ndims = (int)p.src_dims.size();
+        const tag dat_tag = ndims == 2 ? tag::ab : tag::abcd;
+        const tag wei_tag = ndims == 2 ? tag::ab : tag::abcd;
+
+        memory src_plain({p.src_dims, p.src_dt, dat_tag}, eng);
+        memory dst_plain({p.dst_dims, p.src_dt, dat_tag}, eng);
+        memory wei_plain({p.wei_dims, dt::f32, wei_tag}, eng);
+        memory bia_plain({{p.dst_dims[1]}, dt::f32, tag::x}, eng);
+        fill_data(p.src_dt, src_plain, 0.f, 1.f);
+        fill_data(p.src_dt, dst_plain, 0.f, 1.f);
+        fill_data(dt::f32, wei_plain, 1.f, 2.f);
+        fill_data(dt::f32, bia_plain, -1.f, 2.f);
+
+        primitive_attr attr;
+        post_ops ops;
+        ops.append_sum();
+        attr.set_post_ops(ops);
+
+        auto pd = make_pd(primitive_attr());
+        auto acc_pd = make_pd(attr);
+        ASSERT_EQ(acc_pd.get_primitive_attr().get_post_ops().len(), 1);
+
+        std::vector<float> bias, acc_bias;
+        auto grad = execute(
+                pd, src_plain, dst_plain, wei_plain, bia_plain, bias);
+        auto acc = execute(
+                acc_pd, src_plain, dst_plain, wei_plain, bia_plain, acc_bias);
+
+        // Low precision gradients are rounded once with accumulation and
+        // twice without it.
+        const float eps = p.diff_wei_dt == dt::f32 ? 1e-4f : 1e-2f;
+        auto init_wei = map_memory<float>(wei_plain);
+        for (size_t i = 0; i < grad.size(); ++i) {
+            const float expected = init_wei[i] + grad[i];
+            ASSERT_NEAR(acc[i], expected, eps * (1.f + std::fabs(expected)))
+                    << "diff_weights index " << i;
+        }
+
+        if (!p.with_bias) return;
+        auto init_bia = map_memory<float>(bia_plain);
+        for (size_t i = 0; i < bias.size(); ++i) {
+            const float expected = init_bia[i] + bias[i];
+            ASSERT_NEAR(
+                    acc_bias[i], expected, 1e-4f * (1.f + std::fabs(expected)))
+                    << "diff_bias index " << i;
+        }
+    }
+
+    bwd_w_accumulation_params_t p;
+    stream strm;
+};
+
+TEST(bwd_w_accumulation_attr_test_t, TestsUnsupportedPostOps) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Accumulation into gradients is supported on CPU only.");
+    const auto &eng = get_test_engine();
+    auto src_md = memory::desc({8, 16}, dt::f32, tag::any);
+    auto wei_md = memory::desc({32, 16}, dt::f32, tag::any);
+    auto dst_md = memory::desc({8, 32}, dt::f32, tag::any);
+    auto hint = inner_product_forward::primitive_desc(
+            eng, prop_kind::forward_training, src_md, wei_md, dst_md);
+
+    const auto create = [&](const post_ops &ops) {
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        return inner_product_backward_weights::primitive_desc(
+                eng, src_md, wei_md, dst_md, hint, attr);
+    };
+
+    post_ops scaled_sum;
+    scaled_sum.append_sum(2.f);
+    EXPECT_ANY_THROW(create(scaled_sum));
+
+    post_ops typed_sum;
+    typed_sum.append_sum(1.f, 0, dt::f32);
+    EXPECT_ANY_THROW(create(typed_sum));
+
+    post_ops two_sums;
+    two_sums.append_sum();
+    two_sums.append_sum();
+    EXPECT_ANY_THROW(create(two_sums));
+
+    post_ops eltwise;
+    eltwise.append_eltwise(algorithm::eltwise_relu, 0.f, 0.f);
+    EXPECT_ANY_THROW(create(eltwise));
+}
+
+TEST_P(bwd_w_accumulation_test_t, TestsAccumulation) {}
+
+static auto ip_cases = []() {
+    const auto ip = primitive::kind::inner_product;
+    return ::testing::Values(
+            bwd_w_accumulation_params_t {ip, dt::f32, dt::f32, true, {64, 40},
+                    {70, 40}, {64, 70}},
+            bwd_w_accumulation_params_t {ip, dt::f32, dt::f32, false,
+                    {3, 512}, {1000, 512}, {3, 1000}},
+            bwd_w_accumulation_params_t {ip, dt::bf16, dt::f32, true,
+                    {128, 64}, {48, 64}, {128, 48}},
+            bwd_w_accumulation_params_t {ip, dt::bf16, dt::bf16, true,
+                    {32, 64}, {48, 64}, {32, 48}});
+};
+
+static auto conv_cases = []() {
+    const auto conv = primitive::kind::convolution;
+    return ::testing::Values(
+            bwd_w_accumulation_params_t {conv, dt::f32, dt::f32, true,
+                    {2, 20, 10, 10}, {36, 20, 3, 3}, {2, 36, 10, 10}},
+            bwd_w_accumulation_params_t {conv, dt::bf16, dt::f32, true,
+                    {4, 32, 12, 12}, {40, 32, 3, 3}, {4, 40, 12, 12}},
+            bwd_w_accumulation_params_t {conv, dt::bf16, dt::f32, false,
+                    {2, 64, 7, 7}, {64, 64, 3, 3}, {2, 64, 7, 7}});
+};
+
+INSTANTIATE_TEST_SUITE_P(
+        TestBwdWeightsAccumulationIP, bwd_w_accumulation_test_t, ip_cases());
+INSTANTIATE_TEST_SUITE_P(TestBwdWeightsAccumulationConv,
+        bwd_w_accumulation_test_t, conv_cases());
+
+} // namespace dnnl
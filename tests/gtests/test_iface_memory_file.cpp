@@ -0,0 +1,98 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+#ifndef _WIN32
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+namespace dnnl {
+
+#ifndef _WIN32
+class memory_file_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "File-backed memory is supported on CPU only.");
+        char name[] = "/tmp/dnnl_memory_file_XXXXXX";
+        fd = mkstemp(name);
+        ASSERT_GE(fd, 0);
+        unlink(name);
+    }
+
+    void TearDown() override {
+        if (fd >= 0) close(fd);
+    }
+
+    int fd = -1;
+};
+
+TEST_F(memory_file_test_t, TestReorderFromFile) {
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    const memory::dims dims = {32, 16, 3, 3};
+    const memory::dim nelems = 32 * 16 * 3 * 3;
+    memory::desc md(dims, memory::data_type::f32, memory::format_tag::oihw);
+
+    // Place the data at an offset that is not a multiple of the page size.
+    const size_t offset = 64;
+    std::vector<float> data(offset / sizeof(float) + nelems);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = (float)i;
+    const size_t nbytes = data.size() * sizeof(float);
+    ASSERT_EQ(write(fd, data.data(), nbytes), (ssize_t)nbytes);
+
+    auto src = memory::from_file(md, eng, fd, offset);
+    close(fd);
+    fd = -1;
+
+    memory::desc blocked_md(
+            dims, memory::data_type::f32, memory::format_tag::OIhw16i16o);
+    memory blocked(blocked_md, eng), plain(md, eng);
+    reorder(src, blocked).execute(strm, src, blocked);
+    reorder(blocked, plain).execute(strm, blocked, plain);
+    strm.wait();
+
+    auto plain_ptr = map_memory<float>(plain);
+    for (memory::dim i = 0; i < nelems; i++)
+        ASSERT_EQ(plain_ptr[i], data[offset / sizeof(float) + i]);
+
+    // The file-backed memory may not be written to.
+    EXPECT_ANY_THROW(reorder(plain, src).execute(strm, plain, src));
+}
+
+TEST_F(memory_file_test_t, TestInvalidArguments) {
+    auto eng = get_test_engine();
+    memory::desc md({2, 64}, memory::data_type::f32, memory::format_tag::ab);
+
+    std::vector<float> data(64);
+    const size_t nbytes = data.size() * sizeof(float);
+    ASSERT_EQ(write(fd, data.data(), nbytes), (ssize_t)nbytes);
+
+    // The file is shorter than the memory descriptor requires.
+    EXPECT_ANY_THROW(memory::from_file(md, eng, fd));
+    EXPECT_ANY_THROW(memory::from_file(md, eng, -1));
+}
+#endif
+
+} // namespace dnnl
@@ -0,0 +1,190 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+class primitive_args_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        eng = get_test_engine();
+        strm = make_stream(eng);
+
+        md = memory::desc({2, 3, 4, 5}, memory::data_type::f32,
+                memory::format_tag::nchw);
+        auto pd = eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_linear, md,
+                md, 2.f, 1.f);
+        prim = eltwise_forward(pd);
+    }
+
+    void fill(const memory &mem, float base) {
+        auto ptr = map_memory<float>(mem);
+        for (memory::dim i = 0; i < nelems(); i++)
+            ptr[i] = base + i;
+    }
+
+    void check(const memory &src, const memory &dst) {
+        auto src_ptr = map_memory<float>(src);
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < nelems(); i++)
+            ASSERT_EQ(dst_ptr[i], 2.f * src_ptr[i] + 1.f);
+    }
+
+    memory::dim nelems() const { return 2 * 3 * 4 * 5; }
+
+    engine eng;
+    stream strm;
+    memory::desc md;
+    primitive prim;
+};
+
+TEST_F(primitive_args_test_t, TestExecuteBound) {
+    memory src(md, eng), dst(md, eng);
+    fill(src, 0.f);
+
+    primitive_args args(prim, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    prim.execute(strm, args);
+    strm.wait();
+    check(src, dst);
+
+    // Rebinding the data handles of the bound memory objects redirects the
+    // next execution without recreating the arguments.
+    memory other_src(md, eng), other_dst(md, eng);
+    fill(other_src, -17.f);
+    src.set_data_handle(other_src.get_data_handle());
+    dst.set_data_handle(other_dst.get_data_handle());
+    prim.execute(strm, args);
+    strm.wait();
+    check(other_src, other_dst);
+}
+
+TEST_F(primitive_args_test_t, TestInvalidArguments) {
+    memory src(md, eng), dst(md, eng);
+
+    // Missing output.
+    EXPECT_ANY_THROW(primitive_args(prim, {{DNNL_ARG_SRC, src}}));
+
+    // Arguments bound to another primitive.
+    auto other_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_relu, md, md);
+    auto other_prim = eltwise_forward(other_pd);
+    primitive_args args(
+            other_prim, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, dst}});
+    EXPECT_ANY_THROW(prim.execute(strm, args));
+}
+
+TEST_F(primitive_args_test_t, TestCaptureAndReplay) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Stream capture is supported on CPU only.");
+
+    memory src(md, eng), tmp(md, eng), dst(md, eng);
+    fill(src, 0.f);
+    fill(dst, 42.f);
+
+    exec_plan::begin_capture(strm);
+    prim.execute(strm, {{DNNL_ARG_SRC, src}, {DNNL_ARG_DST, tmp}});
+    primitive_args args(prim, {{DNNL_ARG_SRC, tmp}, {DNNL_ARG_DST, dst}});
+    prim.execute(strm, args);
+    auto plan = exec_plan::end_capture(strm);
+
+    // Nothing is executed while capturing.
+    {
+        auto dst_ptr = map_memory<float>(dst);
+        for (memory::dim i = 0; i < nelems(); i++)
+            ASSERT_EQ(dst_ptr[i], 42.f + i);
+    }
+
+    plan.execute(strm);
+    strm.wait();
+    check(src, tmp);
+    check(tmp, dst);
+
+    memory other_src(md, eng);
+    fill(other_src, 5.f);
+    src.set_data_handle(other_src.get_data_handle());
+    plan.execute(strm);
+    strm.wait();
+    check(other_src, tmp);
+    check(tmp, dst);
+
+    // Capture cannot be ended twice.
+    EXPECT_ANY_THROW(exec_plan::end_capture(strm));
+}
+
+TEST_F(primitive_args_test_t, TestReplayChain) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Stream capture is supported on CPU only.");
+
+    // Large enough for every thread to get a share, so that consecutive
+    // primitives replayed in one parallel region depend on the barriers
+    // between them.
+    const memory::dim n = 1 << 20;
+    auto big_md
+            = memory::desc({n}, memory::data_type::f32, memory::format_tag::a);
+    auto linear_pd = eltwise_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::eltwise_linear, big_md,
+            big_md, 2.f, 1.f);
+    auto linear = eltwise_forward(linear_pd);
+    // Softmax splits the chain into primitives run one by one.
+    auto softmax_pd = softmax_forward::primitive_desc(eng,
+            prop_kind::forward_inference, algorithm::softmax_accurate, big_md,
+            big_md, 0);
+    auto softmax = softmax_forward(softmax_pd);
+
+    memory a(big_md, eng), b(big_md, eng), c(big_md, eng);
+    auto run_chain = [&]() {
+        linear.execute(strm, {{DNNL_ARG_SRC, a}, {DNNL_ARG_DST, b}});
+        linear.execute(strm, {{DNNL_ARG_SRC, b}, {DNNL_ARG_DST, c}});
+        linear.execute(strm, {{DNNL_ARG_SRC, c}, {DNNL_ARG_DST, b}});
+        softmax.execute(strm, {{DNNL_ARG_SRC, b}, {DNNL_ARG_DST, c}});
+        linear.execute(strm, {{DNNL_ARG_SRC, c}, {DNNL_ARG_DST, b}});
+        linear.execute(strm, {{DNNL_ARG_SRC, b}, {DNNL_ARG_DST, c}});
+    };
+    auto init = [&]() {
+        auto ptr = map_memory<float>(a);
+        for (memory::dim i = 0; i < n; i++)
+            ptr[i] = (float)(i % 13) / 13.f;
+    };
+
+    init();
+    run_chain();
+    strm.wait();
+    std::vector<float> ref(n);
+    {
+        auto ptr = map_memory<float>(c);
+        for (memory::dim i = 0; i < n; i++)
+            ref[i] = ptr[i];
+    }
+
+    exec_plan::begin_capture(strm);
+    run_chain();
+    auto plan = exec_plan::end_capture(strm);
+    for (int iter = 0; iter < 3; iter++) {
+        init();
+        plan.execute(strm);
+        strm.wait();
+        auto ptr = map_memory<float>(c);
+        for (memory::dim i = 0; i < n; i++)
+            ASSERT_EQ(ptr[i], ref[i]) << "iter = " << iter << ", i = " << i;
+    }
+}
+
+} // namespace dnnl
@@ -116,6 +116,100 @@ TEST(primitive_cache_test, TestCacheHit) {
 #endif
     ASSERT_EQ(get_primitive_cache_size(), 2);
 }
+
+TEST(primitive_cache_test, TestCacheHitFromPrimitiveDesc) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    set_primitive_cache_capacity(0);
+    set_primitive_cache_capacity(4);
+
+    engine eng(get_test_engine_kind(), 0);
+    auto md = memory::desc({2, 16, 3, 3}, dt::f32, tag::nchw);
+    auto make_pd = [&](float alpha) {
+        post_ops ops;
+        ops.append_eltwise(algorithm::eltwise_linear, alpha, 0.f);
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        return binary::primitive_desc(
+                eng, algorithm::binary_add, md, md, md, attr);
+    };
+
+    // Primitives created from the same primitive descriptor share the key
+    // hash memoized in the descriptor.
+    auto pd = make_pd(2.f);
+    auto prim = binary(pd);
+    auto prim_again = binary(pd);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+    ASSERT_TRUE(impl::is_primitive_in_cache(prim.get()));
+
+    // A descriptor created again from the same arguments is a different
+    // object, but its key is equal to the memoized one.
+    auto other_pd = make_pd(2.f);
+    auto other_prim = binary(other_pd);
+    ASSERT_EQ(get_primitive_cache_size(), 1);
+
+    // Keys differing in the attributes only are different.
+    auto pd_alpha = make_pd(3.f);
+    auto prim_alpha = binary(pd_alpha);
+    ASSERT_EQ(get_primitive_cache_size(), 2);
+}
 #endif
 
+template <typename F>
+std::vector<std::string> get_impl_names(const F &make_pd) {
+    std::vector<std::string> names;
+    auto pd = make_pd();
+    do {
+        names.push_back(pd.impl_info_str());
+    } while (pd.next_impl());
+    return names;
+}
+
+TEST(primitive_cache_test, TestImplIdxCacheSkipAhead) {
+    using tag = memory::format_tag;
+    using dt = memory::data_type;
+
+    // Primitive descriptors from the primitive cache skip the search.
+    set_primitive_cache_capacity(0);
+
+    engine eng(get_test_engine_kind(), 0);
+    auto make_conv_pd = [&]() {
+        return convolution_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::convolution_direct,
+                {{2, 16, 7, 7}, dt::f32, tag::any},
+                {{32, 16, 3, 3}, dt::f32, tag::any},
+                {{2, 32, 5, 5}, dt::f32, tag::any}, {1, 1}, {0, 0}, {0, 0});
+    };
+    auto make_matmul_pd = [&]() {
+        return matmul::primitive_desc(eng, {{8, 64}, dt::f32, tag::ab},
+                {{64, 32}, dt::f32, tag::any}, {{8, 32}, dt::f32, tag::ab});
+    };
+    auto make_relu_pd = [&]() {
+        auto md = memory::desc({2, 16, 3, 3}, dt::f32, tag::nChw16c);
+        return eltwise_forward::primitive_desc(eng,
+                prop_kind::forward_inference, algorithm::eltwise_relu, md, md,
+                0.f, 0.f);
+    };
+
+    // Implementations in the order a full search finds them.
+    const int old_capacity = impl::set_impl_idx_cache_capacity(0);
+    const auto conv_ref = get_impl_names(make_conv_pd);
+    const auto matmul_ref = get_impl_names(make_matmul_pd);
+    const auto relu_ref = get_impl_names(make_relu_pd);
+
+    // The first pass memoizes where each search stopped and the next ones
+    // start there. A capacity of 1 evicts the positions as they are added.
+    for (int capacity : {64, 1}) {
+        impl::set_impl_idx_cache_capacity(capacity);
+        for (int pass = 0; pass < 2; pass++) {
+            ASSERT_EQ(get_impl_names(make_conv_pd), conv_ref);
+            ASSERT_EQ(get_impl_names(make_matmul_pd), matmul_ref);
+            ASSERT_EQ(get_impl_names(make_relu_pd), relu_ref);
+        }
+        impl::set_impl_idx_cache_capacity(0);
+    }
+    impl::set_impl_idx_cache_capacity(old_capacity);
+}
+
 } // namespace dnnl
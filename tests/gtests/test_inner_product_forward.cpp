@@ -47,6 +47,7 @@ void compute_ref_inner_product_fwd(test_inner_product_descr_t ipd, memory &src,
     const dnnl::impl::memory_desc_wrapper dst_mdw(dst_d.get());
 
     auto padded_ic = src_mdw.padded_dims()[1];
+    auto padded_wei_ic = weights_mdw.padded_dims()[1];
 
     dnnl::impl::parallel_nd(ipd.mb, ipd.oc, [&](memory::dim n, memory::dim oc) {
         memory::dim oidx = n * ipd.oc + oc;
@@ -59,7 +60,7 @@ void compute_ref_inner_product_fwd(test_inner_product_descr_t ipd, memory &src,
                 memory::dim iidx = n * padded_ic * ipd.kd * ipd.kh * ipd.kw
                         + ic * ipd.kd * ipd.kh * ipd.kw + kd * ipd.kh * ipd.kw
                         + kh * ipd.kw + kw;
-                memory::dim widx = oc * padded_ic * ipd.kd * ipd.kh * ipd.kw
+                memory::dim widx = oc * padded_wei_ic * ipd.kd * ipd.kh * ipd.kw
                         + ic * ipd.kd * ipd.kh * ipd.kw + kd * ipd.kh * ipd.kw
                         + kh * ipd.kw + kw;
                 dst_data[dst_mdw.off_l(oidx, true)]
@@ -493,4 +494,24 @@ INSTANTIATE_TEST_SUITE_P(TestInnerProductForward, inner_product_test_float,
                         memory::format_tag::nc, memory::format_tag::oi,
                         memory::format_tag::x, memory::format_tag::nc,
                         EXPAND_SIZES_2D(2, 8, 16, 1, 1)}));
+
+INSTANTIATE_TEST_SUITE_P(TestInnerProductForwardSmallBatch,
+        inner_product_test_float,
+        ::testing::Values(
+                inprod_test_params_float {prop_kind::forward,
+                        memory::format_tag::any, memory::format_tag::any,
+                        memory::format_tag::any, memory::format_tag::any,
+                        EXPAND_SIZES_2D(1, 300, 1000, 1, 1)},
+                inprod_test_params_float {prop_kind::forward,
+                        memory::format_tag::any, memory::format_tag::any,
+                        memory::format_tag::any, memory::format_tag::any,
+                        EXPAND_SIZES_2D(3, 300, 1000, 1, 1)},
+                inprod_test_params_float {prop_kind::forward,
+                        memory::format_tag::any, memory::format_tag::any,
+                        memory::format_tag::any, memory::format_tag::any,
+                        EXPAND_SIZES_2D(7, 300, 1000, 1, 1)},
+                inprod_test_params_float {prop_kind::forward,
+                        memory::format_tag::nc, memory::format_tag::any,
+                        memory::format_tag::x, memory::format_tag::nc,
+                        EXPAND_SIZES_2D(8, 2048, 520, 1, 1)}));
 } // namespace dnnl
@@ -383,6 +383,354 @@ HANDLE_EXCEPTIONS_FOR_TEST_P(
     ASSERT_EQ(impl_info_no_postops, impl_info_with_postops);
 }
 
+struct output_select_test_t
+    : public ::testing::TestWithParam<memory::format_tag> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(
+        output_select_test_t, TestMatmulOutputSelectMatchesFullMatmul) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Output selection is supported on CPU only");
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim M = 3, K = 96, N_wei = 200, N = 37;
+    const auto dt = memory::data_type::f32;
+    const auto wei_tag = GetParam();
+
+    auto src_md = memory::desc({M, K}, dt, memory::format_tag::ab);
+    auto wei_md = memory::desc({K, N_wei}, dt, wei_tag);
+    auto bia_md = memory::desc({1, N}, dt, memory::format_tag::ab);
+    auto full_dst_md = memory::desc({M, N_wei}, dt, memory::format_tag::ab);
+    auto dst_md = memory::desc({M, N}, dt, memory::format_tag::ab);
+    auto idx_md
+            = memory::desc({N}, memory::data_type::s32, memory::format_tag::a);
+
+    auto src = test::make_memory(src_md, e);
+    auto wei = test::make_memory(wei_md, e);
+    auto bia = test::make_memory(bia_md, e);
+    auto zero_bia = test::make_memory(
+            memory::desc({1, N_wei}, dt, memory::format_tag::ab), e);
+    auto full_dst = test::make_memory(full_dst_md, e);
+    auto dst = test::make_memory(dst_md, e);
+    auto ref_dst = test::make_memory(dst_md, e);
+    auto idx = test::make_memory(idx_md, e);
+
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * N_wei, wei);
+    fill_data<float>(N, bia);
+    {
+        auto ptr = map_memory<float>(zero_bia);
+        for (memory::dim n = 0; n < N_wei; n++)
+            ptr[n] = 0.f;
+    }
+    {
+        // Unordered, strided selection with a repeated column.
+        auto ptr = map_memory<int32_t>(idx);
+        for (memory::dim n = 0; n < N; n++)
+            ptr[n] = static_cast<int32_t>(
+                    ((N_wei - 1 - 7 * n) % N_wei + N_wei) % N_wei);
+        ptr[N - 1] = ptr[0];
+    }
+
+    matmul::primitive_desc full_pd(
+            e, src_md, wei_md, zero_bia.get_desc(), full_dst_md);
+    matmul(full_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, zero_bia}, {DNNL_ARG_DST, full_dst}});
+
+    primitive_attr attr;
+    ASSERT_FALSE(attr.get_output_select());
+    attr.set_output_select(true);
+    ASSERT_TRUE(attr.get_output_select());
+
+    // Without output selection weights and dst dims must match.
+    EXPECT_ANY_THROW(
+            matmul::primitive_desc(e, src_md, wei_md, bia_md, dst_md));
+
+    matmul::primitive_desc pd(e, src_md, wei_md, bia_md, dst_md, attr);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_OUTPUT_SELECT, idx}});
+    s.wait();
+
+    {
+        auto full_ptr = map_memory<const float>(full_dst);
+        auto bia_ptr = map_memory<const float>(bia);
+        auto idx_ptr = map_memory<const int32_t>(idx);
+        auto ref_ptr = map_memory<float>(ref_dst);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++)
+            ref_ptr[m * N + n] = full_ptr[m * N_wei + idx_ptr[n]] + bia_ptr[n];
+    }
+    compare_data<float>(ref_dst, dst);
+
+    // Indices outside of the weights columns are rejected.
+    {
+        auto ptr = map_memory<int32_t>(idx);
+        ptr[0] = static_cast<int32_t>(N_wei);
+    }
+    EXPECT_ANY_THROW(matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_BIAS, bia}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_OUTPUT_SELECT, idx}}));
+}
+
+INSTANTIATE_TEST_SUITE_P(WeightsLayout, output_select_test_t,
+        ::testing::Values(memory::format_tag::ab, memory::format_tag::ba));
+
+using wei_decomp_params_t = std::tuple<memory::data_type, memory::data_type,
+        memory::format_tag>;
+
+struct wei_decomp_test_t
+    : public ::testing::TestWithParam<wei_decomp_params_t> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(
+        wei_decomp_test_t, TestMatmulWeightsDecompressionMatchesF32Matmul) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Weights decompression is supported on CPU only");
+    memory::data_type src_dt, wei_dt;
+    memory::format_tag wei_tag;
+    std::tie(src_dt, wei_dt, wei_tag) = GetParam();
+    SKIP_IF(unsupported_data_type(src_dt),
+            "Engine does not support this data type.");
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim M = 5, K = 75, N = 83;
+    const auto f32 = memory::data_type::f32;
+    const auto s32 = memory::data_type::s32;
+
+    auto src_f32_md = memory::desc({M, K}, f32, memory::format_tag::ab);
+    auto src_md = memory::desc({M, K}, src_dt, memory::format_tag::ab);
+    auto wei_md = memory::desc({K, N}, wei_dt, wei_tag);
+    auto wei_f32_md = memory::desc({K, N}, f32, memory::format_tag::ab);
+    auto dst_md = memory::desc({M, N}, f32, memory::format_tag::ab);
+    auto qparams_md = memory::desc({N}, f32, memory::format_tag::a);
+    auto zp_md = memory::desc({N}, s32, memory::format_tag::a);
+
+    auto src_f32 = test::make_memory(src_f32_md, e);
+    auto src = test::make_memory(src_md, e);
+    auto wei = test::make_memory(wei_md, e);
+    auto wei_f32 = test::make_memory(wei_f32_md, e);
+    auto scales = test::make_memory(qparams_md, e);
+    auto zero_points = test::make_memory(zp_md, e);
+    auto dst = test::make_memory(dst_md, e);
+    auto ref_dst = test::make_memory(dst_md, e);
+
+    // Round-trip the source through its data type to get the exact values
+    // used by the decompressed matmul.
+    fill_data<float>(M * K, src_f32);
+    reorder(src_f32, src).execute(s, src_f32, src);
+    reorder(src, src_f32).execute(s, src, src_f32);
+
+    const bool is_s8 = wei_dt == memory::data_type::s8;
+    {
+        const memory::desc wei_d = wei.get_desc();
+        const memory::dims wei_strides = wei_d.get_strides();
+        auto wei_ptr = map_memory<uint8_t>(wei);
+        auto wei_f32_ptr = map_memory<float>(wei_f32);
+        auto scales_ptr = map_memory<float>(scales);
+        auto zp_ptr = map_memory<int32_t>(zero_points);
+        for (memory::dim n = 0; n < N; n++) {
+            scales_ptr[n] = 0.25f * (1 + n % 3);
+            zp_ptr[n] = is_s8 ? n % 5 - 2 : 120 + n % 7;
+        }
+        for_(memory::dim k = 0; k < K; k++)
+        for (memory::dim n = 0; n < N; n++) {
+            const int v = (int)((k * 7 + n * 13) % 251);
+            const int w = is_s8 ? v - 125 : v;
+            wei_ptr[k * wei_strides[0] + n * wei_strides[1]]
+                    = static_cast<uint8_t>(w);
+            wei_f32_ptr[k * N + n] = (w - zp_ptr[n]) * scales_ptr[n];
+        }
+    }
+
+    matmul::primitive_desc ref_pd(e, src_f32_md, wei_f32_md, dst_md);
+    matmul(ref_pd).execute(s,
+            {{DNNL_ARG_SRC, src_f32}, {DNNL_ARG_WEIGHTS, wei_f32},
+                    {DNNL_ARG_DST, ref_dst}});
+
+    primitive_attr attr;
+    attr.set_scales_mask(DNNL_ARG_WEIGHTS, 1 << 1);
+    attr.set_zero_points_mask(DNNL_ARG_WEIGHTS, 1 << 1);
+
+    // Integer weights require the fpmath mode to apply to them.
+    EXPECT_ANY_THROW(matmul::primitive_desc(e, src_md, wei_md, dst_md, attr));
+
+    attr.set_fpmath_mode(fpmath_mode::strict, true);
+    fpmath_mode mode;
+    bool apply_to_int = false;
+    attr.get_fpmath_mode(mode, apply_to_int);
+    ASSERT_EQ(mode, fpmath_mode::strict);
+    ASSERT_TRUE(apply_to_int);
+
+    matmul::primitive_desc pd(e, src_md, wei_md, dst_md, attr);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei}, {DNNL_ARG_DST, dst},
+                    {DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS, scales},
+                    {DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS,
+                            zero_points}});
+    s.wait();
+
+    compare_data<float>(ref_dst, dst);
+}
+
+INSTANTIATE_TEST_SUITE_P(DataTypes, wei_decomp_test_t,
+        ::testing::Combine(::testing::Values(memory::data_type::f32,
+                                   memory::data_type::bf16),
+                ::testing::Values(memory::data_type::s8, memory::data_type::u8),
+                ::testing::Values(
+                        memory::format_tag::ab, memory::format_tag::ba)));
+
+struct glu_test_t : public ::testing::TestWithParam<algorithm> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(glu_test_t, TestMatmulGluMatchesGatedFullMatmul) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Gated activation is supported on CPU only");
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim M = 7, K = 64, N = 45;
+    const auto dt = memory::data_type::f32;
+    const auto alg = GetParam();
+    const float alpha = alg == algorithm::eltwise_swish ? 1.f : 0.f;
+
+    auto src_md = memory::desc({M, K}, dt, memory::format_tag::ab);
+    auto wei_md = memory::desc({K, 2 * N}, dt, memory::format_tag::ab);
+    auto full_dst_md = memory::desc({M, 2 * N}, dt, memory::format_tag::ab);
+    auto dst_md = memory::desc({M, N}, dt, memory::format_tag::ab);
+
+    auto src = test::make_memory(src_md, e);
+    auto wei = test::make_memory(wei_md, e);
+    auto full_dst = test::make_memory(full_dst_md, e);
+    auto dst = test::make_memory(dst_md, e);
+    auto ref_dst = test::make_memory(dst_md, e);
+
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * 2 * N, wei);
+
+    matmul::primitive_desc full_pd(e, src_md, wei_md, full_dst_md);
+    matmul(full_pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, full_dst}});
+
+    post_ops ops;
+    ops.append_glu(alg, alpha, 0.f);
+    algorithm q_alg;
+    float q_alpha, q_beta;
+    ops.get_params_glu(0, q_alg, q_alpha, q_beta);
+    ASSERT_EQ(q_alg, alg);
+    ASSERT_EQ(q_alpha, alpha);
+    ASSERT_EQ(q_beta, 0.f);
+
+    primitive_attr attr;
+    attr.set_post_ops(ops);
+
+    // Without the gating weights and dst dims must match, and with it the
+    // weights must hold both halves.
+    EXPECT_ANY_THROW(matmul::primitive_desc(e, src_md, wei_md, dst_md));
+    EXPECT_ANY_THROW(
+            matmul::primitive_desc(e, src_md, wei_md, full_dst_md, attr));
+
+    matmul::primitive_desc pd(e, src_md, wei_md, dst_md, attr);
+    matmul(pd).execute(s,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                    {DNNL_ARG_DST, dst}});
+    s.wait();
+
+    {
+        auto full_ptr = map_memory<const float>(full_dst);
+        auto ref_ptr = map_memory<float>(ref_dst);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++) {
+            const float g = full_ptr[m * 2 * N + n];
+            const float act = alg == algorithm::eltwise_swish
+                    ? g / (1.f + std::exp(-alpha * g))
+                    : 0.5f * g * (1.f + std::erf(g / std::sqrt(2.f)));
+            ref_ptr[m * N + n] = act * full_ptr[m * 2 * N + N + n];
+        }
+    }
+    compare_data<float>(ref_dst, dst);
+}
+
+INSTANTIATE_TEST_SUITE_P(Algorithms, glu_test_t,
+        ::testing::Values(
+                algorithm::eltwise_swish, algorithm::eltwise_gelu_erf));
+
+struct strided_binary_test_t : public ::testing::TestWithParam<bool> {};
+
+HANDLE_EXCEPTIONS_FOR_TEST_P(
+        strided_binary_test_t, TestMatmulBinaryPostOpWithStridedSrc1) {
+    auto engine_kind = get_test_engine_kind();
+    SKIP_IF(engine_kind != engine::kind::cpu,
+            "Strided binary post-op source is tested on CPU only");
+    engine e {engine_kind, 0};
+    stream s(e);
+
+    const memory::dim M = 13, K = 40, N = 70, LD = 96, off_n = 5;
+    const auto dt = memory::data_type::f32;
+    const bool transposed = GetParam();
+
+    auto src_md = memory::desc({M, K}, dt, memory::format_tag::ab);
+    auto wei_md = memory::desc({K, N}, dt, memory::format_tag::ab);
+    auto dst_md = memory::desc({M, N}, dt, memory::format_tag::ab);
+
+    // The binary source is either a column slice of a wider residual buffer
+    // or a transposed view of it.
+    auto res_md = transposed
+            ? memory::desc({LD, M}, dt, memory::format_tag::ab)
+            : memory::desc({M, LD}, dt, memory::format_tag::ab);
+    auto src1_md = transposed
+            ? res_md.submemory_desc({N, M}, {off_n, 0}).permute_axes({1, 0})
+            : res_md.submemory_desc({M, N}, {0, off_n});
+
+    auto src = test::make_memory(src_md, e);
+    auto wei = test::make_memory(wei_md, e);
+    auto res = test::make_memory(res_md, e);
+    auto src1_dense = test::make_memory(dst_md, e);
+    auto dst = test::make_memory(dst_md, e);
+    auto ref_dst = test::make_memory(dst_md, e);
+    memory src1(src1_md, e, res.get_data_handle());
+
+    fill_data<float>(M * K, src);
+    fill_data<float>(K * N, wei);
+    fill_data<float>(M * LD, res);
+    {
+        auto res_ptr = map_memory<const float>(res);
+        auto dense_ptr = map_memory<float>(src1_dense);
+        for_(memory::dim m = 0; m < M; m++)
+        for (memory::dim n = 0; n < N; n++)
+            dense_ptr[m * N + n] = transposed
+                    ? res_ptr[(n + off_n) * M + m]
+                    : res_ptr[m * LD + n + off_n];
+    }
+
+    auto run = [&](const memory &bin_src, const memory &out) {
+        post_ops ops;
+        ops.append_binary(algorithm::binary_add, bin_src.get_desc());
+        primitive_attr attr;
+        attr.set_post_ops(ops);
+        matmul::primitive_desc pd(e, src_md, wei_md, dst_md, attr);
+        matmul(pd).execute(s,
+                {{DNNL_ARG_SRC, src}, {DNNL_ARG_WEIGHTS, wei},
+                        {DNNL_ARG_DST, out},
+                        {DNNL_ARG_ATTR_MULTIPLE_POST_OP(0) | DNNL_ARG_SRC_1,
+                                bin_src}});
+        s.wait();
+    };
+    run(src1_dense, ref_dst);
+    run(src1, dst);
+
+    compare_data<float>(ref_dst, dst);
+}
+
+INSTANTIATE_TEST_SUITE_P(Src1View, strided_binary_test_t,
+        ::testing::Values(false, true));
+
 /********************************* TEST CASES *********************************/
 
 using iface = matmul_iface_test_t;
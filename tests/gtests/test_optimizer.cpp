@@ -0,0 +1,367 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct optimizer_test_params_t {
+    algorithm aalgorithm;
+    dt weights_dt;
+    dt diff_weights_dt;
+    tag weights_tag;
+    memory::dims dims;
+    float beta_1;
+    float beta_2;
+    float epsilon;
+    float weight_decay;
+    optimizer_flags flags;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class optimizer_test_t
+    : public ::testing::TestWithParam<optimizer_test_params_t> {
+private:
+    optimizer_test_params_t p;
+
+    static float get_elem(const memory &mem, size_t i) {
+        switch (mem.get_desc().get_data_type()) {
+            case dt::bf16: return map_memory<bfloat16_t>(mem)[i];
+            case dt::f16: return map_memory<float16_t>(mem)[i];
+            default: return map_memory<float>(mem)[i];
+        }
+    }
+
+    static float round_to(dt data_type, float v) {
+        switch (data_type) {
+            case dt::bf16: return bfloat16_t(v);
+            case dt::f16: return float16_t(v);
+            default: return v;
+        }
+    }
+
+    static void fill(const memory &mem, const std::vector<float> &v) {
+        switch (mem.get_desc().get_data_type()) {
+            case dt::bf16: {
+                auto ptr = map_memory<bfloat16_t>(mem);
+                for (size_t i = 0; i < v.size(); ++i)
+                    ptr[i] = v[i];
+                break;
+            }
+            case dt::f16: {
+                auto ptr = map_memory<float16_t>(mem);
+                for (size_t i = 0; i < v.size(); ++i)
+                    ptr[i] = v[i];
+                break;
+            }
+            default: {
+                auto ptr = map_memory<float>(mem);
+                for (size_t i = 0; i < v.size(); ++i)
+                    ptr[i] = v[i];
+            }
+        }
+    }
+
+    // Applies one step of the optimizer to the reference weights and
+    // moments, returns the squared norm of the scaled gradient.
+    float ref_step(std::vector<float> &w, std::vector<float> &m1,
+            std::vector<float> &m2, const std::vector<float> &diff_w,
+            float scale, float lr, int step) const {
+        const float b1 = p.beta_1, b2 = p.beta_2, eps = p.epsilon;
+        const float wd = p.weight_decay;
+        const float bc1 = 1.f - std::pow(b1, (float)step);
+        const float bc2 = 1.f - std::pow(b2, (float)step);
+        const size_t n = w.size();
+
+        float diff_w_sq = 0.f;
+        std::vector<float> r(n);
+        for (size_t i = 0; i < n; ++i) {
+            const float g = scale * diff_w[i];
+            diff_w_sq += g * g;
+            switch (p.aalgorithm) {
+                case algorithm::optimizer_sgd:
+                    if (b1 != 0.f) {
+                        m1[i] = b1 * m1[i] + g + wd * w[i];
+                        r[i] = m1[i];
+                    } else {
+                        r[i] = g + wd * w[i];
+                    }
+                    break;
+                case algorithm::optimizer_adam: {
+                    const float gg = g + wd * w[i];
+                    m1[i] = b1 * m1[i] + (1.f - b1) * gg;
+                    m2[i] = b2 * m2[i] + (1.f - b2) * gg * gg;
+                    r[i] = (m1[i] / bc1) / (std::sqrt(m2[i] / bc2) + eps);
+                    break;
+                }
+                case algorithm::optimizer_adamw:
+                case algorithm::optimizer_lamb:
+                    m1[i] = b1 * m1[i] + (1.f - b1) * g;
+                    m2[i] = b2 * m2[i] + (1.f - b2) * g * g;
+                    r[i] = (m1[i] / bc1) / (std::sqrt(m2[i] / bc2) + eps);
+                    if (p.aalgorithm == algorithm::optimizer_lamb)
+                        r[i] += wd * w[i];
+                    break;
+                default: assert(!"unexpected algorithm");
+            }
+        }
+
+        float trust_ratio = 1.f;
+        if (p.aalgorithm == algorithm::optimizer_lamb) {
+            float w_sq = 0.f, r_sq = 0.f;
+            for (size_t i = 0; i < n; ++i) {
+                w_sq += w[i] * w[i];
+                r_sq += r[i] * r[i];
+            }
+            if (w_sq > 0.f && r_sq > 0.f)
+                trust_ratio = std::sqrt(w_sq) / std::sqrt(r_sq);
+        }
+        const float decay = p.aalgorithm == algorithm::optimizer_adamw
+                ? 1.f - lr * wd
+                : 1.f;
+        for (size_t i = 0; i < n; ++i)
+            w[i] = decay * w[i] - lr * trust_ratio * r[i];
+        return diff_w_sq;
+    }
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<optimizer_test_params_t>::GetParam();
+
+        SKIP_IF(unsupported_data_type(p.weights_dt)
+                        || unsupported_data_type(p.diff_weights_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = optimizer::primitive_desc;
+        allows_attr_t allowed_attributes {false}; // doesn't support anything
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        auto weights_md = memory::desc(p.dims, p.weights_dt, p.weights_tag);
+        auto diff_weights_md
+                = memory::desc(p.dims, p.diff_weights_dt, tag::any);
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, p.aalgorithm, weights_md, diff_weights_md, p.beta_1,
+                p.beta_2, p.epsilon, p.weight_decay, p.flags);
+        // test all pd ctors
+        test_fwd_pd_constructors<pd_t>(pd, allowed_attributes, p.aalgorithm,
+                weights_md, diff_weights_md, p.beta_1, p.beta_2, p.epsilon,
+                p.weight_decay, p.flags);
+
+        // The gradient is unscaled through a runtime scale.
+        primitive_attr attr;
+        attr.set_scales_mask(DNNL_ARG_DIFF_WEIGHTS, 0);
+        pd = pd_t(eng, p.aalgorithm, weights_md, diff_weights_md, p.beta_1,
+                p.beta_2, p.epsilon, p.weight_decay, p.flags, attr);
+
+        EXPECT_ANY_THROW(optimizer(pd, {}));
+        // default primitive ctor
+        auto prim = optimizer();
+        // regular primitive ctor
+        prim = optimizer(pd);
+
+        ASSERT_EQ(pd.get_algorithm(), p.aalgorithm);
+        ASSERT_EQ(pd.get_epsilon(), p.epsilon);
+        ASSERT_EQ(pd.get_flags(), p.flags);
+        ASSERT_TRUE(pd.weights_desc() == weights_md);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_DIFF_WEIGHTS)
+                == pd.diff_weights_desc());
+
+        const bool use_master
+                = (p.flags & optimizer_flags::use_master_weights)
+                != optimizer_flags::none;
+        const bool use_norm
+                = (p.flags & optimizer_flags::compute_diff_weights_norm)
+                != optimizer_flags::none;
+        const bool is_sgd = p.aalgorithm == algorithm::optimizer_sgd;
+        const bool use_m1 = !is_sgd || p.beta_1 != 0.f;
+        const bool use_m2 = !is_sgd;
+
+        ASSERT_EQ(pd.master_weights_desc().is_zero(), !use_master);
+        ASSERT_EQ(pd.moment_1_desc().is_zero(), !use_m1);
+        ASSERT_EQ(pd.moment_2_desc().is_zero(), !use_m2);
+
+        size_t n = 1;
+        for (auto d : p.dims)
+            n *= (size_t)d;
+        std::vector<float> w(n), m1(n, 0.f), m2(n, 0.f), diff_w(n);
+        for (size_t i = 0; i < n; ++i)
+            w[i] = round_to(p.weights_dt, 0.5f - float((i * 13) % 17) / 16.f);
+
+        auto weights = test::make_memory(pd.weights_desc(), eng);
+        auto diff_weights = test::make_memory(pd.diff_weights_desc(), eng);
+        fill(weights, w);
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_WEIGHTS, weights},
+                {DNNL_ARG_DIFF_WEIGHTS, diff_weights}};
+        auto add_arg = [&](int arg, const memory::desc &md,
+                               const std::vector<float> &v) {
+            auto mem = test::make_memory(md, eng);
+            if (!v.empty()) fill(mem, v);
+            args.insert({arg, mem});
+            return mem;
+        };
+
+        memory master_weights, moment_1, moment_2, norm, step;
+        if (use_master)
+            master_weights = add_arg(
+                    DNNL_ARG_MASTER_WEIGHTS, pd.master_weights_desc(), w);
+        if (use_m1)
+            moment_1 = add_arg(DNNL_ARG_MOMENT_1, pd.moment_1_desc(), m1);
+        if (use_m2)
+            moment_2 = add_arg(DNNL_ARG_MOMENT_2, pd.moment_2_desc(), m2);
+        if (use_norm)
+            norm = add_arg(DNNL_ARG_DIFF_WEIGHTS_NORM,
+                    pd.query_md(query::exec_arg_md, DNNL_ARG_DIFF_WEIGHTS_NORM),
+                    {});
+        if (use_m2) {
+            step = test::make_memory(
+                    pd.query_md(query::exec_arg_md, DNNL_ARG_STEP), eng);
+            args.insert({DNNL_ARG_STEP, step});
+        }
+
+        const float lr = 0.01f, scale = 0.5f;
+        add_arg(DNNL_ARG_LEARNING_RATE,
+                pd.query_md(query::exec_arg_md, DNNL_ARG_LEARNING_RATE), {lr});
+        add_arg(DNNL_ARG_ATTR_SCALES | DNNL_ARG_DIFF_WEIGHTS,
+                memory::desc({1}, dt::f32, tag::x), {scale});
+
+        const float eps
+                = p.weights_dt == dt::f32 && !use_master ? 1e-5f : 1e-2f;
+        for (int s = 1; s <= 2; ++s) {
+            for (size_t i = 0; i < n; ++i)
+                diff_w[i] = round_to(p.diff_weights_dt,
+                        float((i * 7 + s) % 11) / 5.f - 1.f);
+            fill(diff_weights, diff_w);
+            if (use_m2) map_memory<int32_t>(step)[0] = s;
+
+            prim.execute(strm, args);
+            strm.wait();
+
+            const float norm_sq = ref_step(w, m1, m2, diff_w, scale, lr, s);
+            if (!use_master)
+                for (auto &v : w)
+                    v = round_to(p.weights_dt, v);
+
+            for (size_t i = 0; i < n; ++i) {
+                ASSERT_NEAR(get_elem(weights, i), round_to(p.weights_dt, w[i]),
+                        eps * (1.f + std::fabs(w[i])))
+                        << "step " << s << ", weights at " << i;
+                if (use_master)
+                    ASSERT_NEAR(get_elem(master_weights, i), w[i], 1e-5f)
+                            << "step " << s << ", master weights at " << i;
+                if (use_m1)
+                    ASSERT_NEAR(get_elem(moment_1, i), m1[i], 1e-5f)
+                            << "step " << s << ", moment 1 at " << i;
+                if (use_m2)
+                    ASSERT_NEAR(get_elem(moment_2, i), m2[i], 1e-5f)
+                            << "step " << s << ", moment 2 at " << i;
+            }
+            if (use_norm)
+                ASSERT_NEAR(get_elem(norm, 0), norm_sq, 1e-4f * norm_sq);
+        }
+    }
+};
+
+static const auto none = optimizer_flags::none;
+static const auto use_master = optimizer_flags::use_master_weights;
+static const auto use_norm = optimizer_flags::compute_diff_weights_norm;
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // not supported alg_kind
+            optimizer_test_params_t {algorithm::eltwise_relu, dt::f32, dt::f32,
+                    tag::ab, {4, 4}, 0.9f, 0.999f, 1e-8f, 0.f, none, true,
+                    dnnl_invalid_arguments},
+            // beta_1 out of range
+            optimizer_test_params_t {algorithm::optimizer_adam, dt::f32,
+                    dt::f32, tag::ab, {4, 4}, 1.f, 0.999f, 1e-8f, 0.f, none,
+                    true, dnnl_invalid_arguments},
+            // negative weight decay
+            optimizer_test_params_t {algorithm::optimizer_sgd, dt::f32,
+                    dt::f32, tag::ab, {4, 4}, 0.9f, 0.f, 0.f, -1.f, none, true,
+                    dnnl_invalid_arguments},
+            // padded weights
+            optimizer_test_params_t {algorithm::optimizer_sgd, dt::f32,
+                    dt::f32, tag::aBcd16b, {2, 3, 4, 4}, 0.9f, 0.f, 0.f, 0.f,
+                    none, true, dnnl_unimplemented});
+};
+
+static auto f32_cases = []() {
+    return ::testing::Values(
+            optimizer_test_params_t {algorithm::optimizer_sgd, dt::f32,
+                    dt::f32, tag::ab, {3, 5}, 0.f, 0.f, 0.f, 0.f, none},
+            optimizer_test_params_t {algorithm::optimizer_sgd, dt::f32,
+                    dt::f32, tag::ab, {64, 65}, 0.9f, 0.f, 0.f, 1e-2f,
+                    use_norm},
+            optimizer_test_params_t {algorithm::optimizer_adam, dt::f32,
+                    dt::f32, tag::ba, {33, 70}, 0.9f, 0.999f, 1e-8f, 1e-2f,
+                    none},
+            optimizer_test_params_t {algorithm::optimizer_adamw, dt::f32,
+                    dt::f32, tag::abcd, {2, 16, 7, 9}, 0.9f, 0.999f, 1e-6f,
+                    1e-1f, use_norm},
+            optimizer_test_params_t {algorithm::optimizer_adamw, dt::f32,
+                    dt::f32, tag::aBcd16b, {2, 32, 3, 3}, 0.9f, 0.99f, 1e-6f,
+                    1e-1f, none},
+            optimizer_test_params_t {algorithm::optimizer_lamb, dt::f32,
+                    dt::f32, tag::a, {5000}, 0.9f, 0.999f, 1e-6f, 1e-2f,
+                    use_norm});
+};
+
+static auto mixed_cases = []() {
+    return ::testing::Values(
+            optimizer_test_params_t {algorithm::optimizer_sgd, dt::bf16,
+                    dt::bf16, tag::ab, {17, 100}, 0.9f, 0.f, 0.f, 0.f,
+                    use_master},
+            optimizer_test_params_t {algorithm::optimizer_adamw, dt::bf16,
+                    dt::f32, tag::ab, {17, 100}, 0.9f, 0.999f, 1e-8f, 1e-2f,
+                    use_master | use_norm},
+            optimizer_test_params_t {algorithm::optimizer_adam, dt::f16,
+                    dt::f16, tag::ab, {32, 32}, 0.9f, 0.999f, 1e-4f, 0.f,
+                    none},
+            optimizer_test_params_t {algorithm::optimizer_lamb, dt::bf16,
+                    dt::bf16, tag::a, {3000}, 0.9f, 0.999f, 1e-6f, 1e-2f,
+                    use_master});
+};
+
+TEST_P(optimizer_test_t, TestsOptimizer) {}
+INSTANTIATE_TEST_SUITE_P(
+        TestOptimizerEF, optimizer_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestOptimizerF32, optimizer_test_t, f32_cases());
+INSTANTIATE_TEST_SUITE_P(TestOptimizerMixed, optimizer_test_t, mixed_cases());
+
+} // namespace dnnl
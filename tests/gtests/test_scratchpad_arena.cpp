@@ -0,0 +1,227 @@
+/*******************************************************************************
+* Copyright 2026 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+#include "src/common/scratchpad.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+class scratchpad_arena_test_t : public ::testing::Test {
+protected:
+    void SetUp() override {
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "The scratchpad arena is supported on CPU only.");
+#if DNNL_CPU_THREADING_RUNTIME == DNNL_RUNTIME_THREADPOOL
+        SKIP_IF(true, "The scratchpad arena is not supported with threadpool.");
+#endif
+        // Start from an empty arena. The capacity has to be non-zero when a
+        // primitive is created for it to use the arena.
+        old_capacity_ = impl::set_scratchpad_arena_capacity(0);
+        impl::set_scratchpad_arena_capacity(1 << 30);
+        eng = get_test_engine();
+    }
+
+    void TearDown() override {
+        if (get_test_engine_kind() != engine::kind::cpu) return;
+        impl::set_scratchpad_arena_capacity(0);
+        impl::set_scratchpad_arena_capacity(old_capacity_);
+    }
+
+    // RNN primitives take their workspace from the global scratchpad. Each
+    // problem has its own inputs, and its output is compared with the one of
+    // the same primitive run with a user-provided scratchpad, so a buffer
+    // shared by two executions at a time shows in the results.
+    struct problem_t {
+        problem_t(const engine &eng, memory::dim n, float offset)
+            : pd(make_pd(eng, n, primitive_attr()))
+            , prim(pd)
+            , src(pd.src_layer_desc(), eng)
+            , wei_layer(pd.weights_layer_desc(), eng)
+            , wei_iter(pd.weights_iter_desc(), eng)
+            , bias(pd.bias_desc(), eng)
+            , dst(pd.dst_layer_desc(), eng) {
+            fill(src, offset, 1.f);
+            fill(wei_layer, 0.f, 0.01f);
+            fill(wei_iter, 0.f, -0.01f);
+            fill(bias, 0.1f, 0.f);
+
+            primitive_attr attr;
+            attr.set_scratchpad_mode(scratchpad_mode::user);
+            auto user_pd = make_pd(eng, n, attr);
+            memory ref_dst(pd.dst_layer_desc(), eng);
+            memory scratchpad(user_pd.scratchpad_desc(), eng);
+            stream strm(eng);
+            vanilla_rnn_forward(user_pd).execute(strm,
+                    {{DNNL_ARG_SRC_LAYER, src},
+                            {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                            {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                            {DNNL_ARG_BIAS, bias},
+                            {DNNL_ARG_DST_LAYER, ref_dst},
+                            {DNNL_ARG_SCRATCHPAD, scratchpad}});
+            strm.wait();
+            auto ptr = map_memory<float>(ref_dst);
+            for (memory::dim i = 0; i < nelems(ref_dst); i++)
+                ref.push_back(ptr[i]);
+        }
+
+        static vanilla_rnn_forward::primitive_desc make_pd(const engine &eng,
+                memory::dim n, const primitive_attr &attr) {
+            const memory::dim T = 4, C = 32;
+            return vanilla_rnn_forward::primitive_desc(eng,
+                    prop_kind::forward_inference, algorithm::eltwise_tanh,
+                    rnn_direction::unidirectional_left2right,
+                    {{T, n, C}, dt::f32, tag::tnc}, memory::desc(),
+                    {{1, 1, C, 1, C}, dt::f32, tag::ldigo},
+                    {{1, 1, C, 1, C}, dt::f32, tag::ldigo},
+                    {{1, 1, 1, C}, dt::f32, tag::ldgo},
+                    {{T, n, C}, dt::f32, tag::tnc}, memory::desc(), attr);
+        }
+
+        static memory::dim nelems(const memory &mem) {
+            return mem.get_desc().get_size() / sizeof(float);
+        }
+
+        static void fill(const memory &mem, float base, float step) {
+            auto ptr = map_memory<float>(mem);
+            for (memory::dim i = 0; i < nelems(mem); i++)
+                ptr[i] = base + step * (float)(i % 7 - 3);
+        }
+
+        size_t scratchpad_size() const {
+            return (size_t)pd.query_s64(query::memory_consumption_s64);
+        }
+
+        void execute(const stream &strm) const {
+            prim.execute(strm,
+                    {{DNNL_ARG_SRC_LAYER, src},
+                            {DNNL_ARG_WEIGHTS_LAYER, wei_layer},
+                            {DNNL_ARG_WEIGHTS_ITER, wei_iter},
+                            {DNNL_ARG_BIAS, bias}, {DNNL_ARG_DST_LAYER, dst}});
+        }
+
+        void check() const {
+            auto ptr = map_memory<float>(dst);
+            for (memory::dim i = 0; i < nelems(dst); i++)
+                ASSERT_EQ(ptr[i], ref[i]) << "i = " << i;
+        }
+
+        vanilla_rnn_forward::primitive_desc pd;
+        vanilla_rnn_forward prim;
+        memory src, wei_layer, wei_iter, bias, dst;
+        std::vector<float> ref;
+    };
+
+    engine eng;
+    size_t old_capacity_ = 0;
+};
+
+TEST_F(scratchpad_arena_test_t, TestReuse) {
+    problem_t p(eng, 64, 0.f);
+    const size_t size = p.scratchpad_size();
+    SKIP_IF(size == 0, "The implementation does not use a scratchpad.");
+
+    stream strm(eng);
+    // The buffer goes back to the arena after each execution and is taken
+    // again by the next one instead of a new buffer.
+    for (int i = 0; i < 3; i++) {
+        p.execute(strm);
+        strm.wait();
+        ASSERT_EQ(impl::get_scratchpad_arena_cached_size(), size);
+    }
+    p.check();
+
+    // A smaller scratchpad takes the cached buffer as well.
+    problem_t small(eng, 32, 100.f);
+    SKIP_IF(small.scratchpad_size() > size, "Unexpected scratchpad size.");
+    small.execute(strm);
+    strm.wait();
+    ASSERT_EQ(impl::get_scratchpad_arena_cached_size(), size);
+    small.check();
+}
+
+TEST_F(scratchpad_arena_test_t, TestCapacityOverflow) {
+    problem_t p(eng, 64, 0.f);
+    const size_t size = p.scratchpad_size();
+    SKIP_IF(size == 0, "The implementation does not use a scratchpad.");
+
+    // A buffer that does not fit the capacity is freed once released, and a
+    // new one is allocated for every execution.
+    impl::set_scratchpad_arena_capacity(size - 1);
+    stream strm(eng);
+    for (int i = 0; i < 3; i++) {
+        p.execute(strm);
+        strm.wait();
+        ASSERT_EQ(impl::get_scratchpad_arena_cached_size(), 0u);
+        p.check();
+    }
+
+    // Lowering the capacity frees the cached buffers that no longer fit.
+    impl::set_scratchpad_arena_capacity(size);
+    p.execute(strm);
+    strm.wait();
+    ASSERT_EQ(impl::get_scratchpad_arena_cached_size(), size);
+    impl::set_scratchpad_arena_capacity(size - 1);
+    ASSERT_EQ(impl::get_scratchpad_arena_cached_size(), 0u);
+}
+
+TEST_F(scratchpad_arena_test_t, TestConcurrentPrimitives) {
+    const int nthreads = 4;
+    std::vector<std::unique_ptr<problem_t>> problems;
+    size_t total_size = 0;
+    for (int i = 0; i < nthreads; i++) {
+        problems.emplace_back(new problem_t(eng, 32 * (i + 1), 100.f * i));
+        total_size += problems.back()->scratchpad_size();
+    }
+    SKIP_IF(total_size == 0, "The implementation does not use a scratchpad.");
+
+    // Each thread runs its own primitive. The buffers held at the same time
+    // must not overlap, which the results check.
+    std::vector<std::thread> threads;
+    for (int i = 0; i < nthreads; i++)
+        threads.emplace_back([&, i]() {
+            stream strm(eng);
+            for (int iter = 0; iter < 10; iter++)
+                problems[i]->execute(strm);
+            strm.wait();
+        });
+    for (auto &t : threads)
+        t.join();
+
+    for (const auto &p : problems)
+        p->check();
+
+    // All buffers are back in the arena and serve any of the primitives
+    // without allocating new ones.
+    const size_t cached_size = impl::get_scratchpad_arena_cached_size();
+    ASSERT_GE(cached_size, problems.back()->scratchpad_size());
+    stream strm(eng);
+    for (const auto &p : problems)
+        p->execute(strm);
+    strm.wait();
+    ASSERT_EQ(impl::get_scratchpad_arena_cached_size(), cached_size);
+}
+
+} // namespace dnnl
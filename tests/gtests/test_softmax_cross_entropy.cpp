@@ -0,0 +1,284 @@
+/*******************************************************************************
+* Copyright 2023 Intel Corporation
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+*     http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*******************************************************************************/
+
+#include <cmath>
+
+#include "dnnl_test_common.hpp"
+#include "gtest/gtest.h"
+
+#include "oneapi/dnnl/dnnl.hpp"
+
+namespace dnnl {
+
+using dt = memory::data_type;
+using tag = memory::format_tag;
+
+struct softmax_cross_entropy_test_params_t {
+    dt src_dt;
+    dt diff_src_dt; // dt::undef means no gradient
+    memory::dim n;
+    memory::dim c;
+    float label_smoothing;
+    bool expect_to_fail;
+    dnnl_status_t expected_status;
+};
+
+class softmax_cross_entropy_test_t
+    : public ::testing::TestWithParam<softmax_cross_entropy_test_params_t> {
+private:
+    softmax_cross_entropy_test_params_t p;
+
+    static float get_elem(const memory &mem, size_t i) {
+        switch (mem.get_desc().get_data_type()) {
+            case dt::bf16: return map_memory<bfloat16_t>(mem)[i];
+            case dt::f16: return map_memory<float16_t>(mem)[i];
+            default: return map_memory<float>(mem)[i];
+        }
+    }
+
+    static void fill(const memory &mem, const std::vector<float> &v) {
+        switch (mem.get_desc().get_data_type()) {
+            case dt::bf16: {
+                auto ptr = map_memory<bfloat16_t>(mem);
+                for (size_t i = 0; i < v.size(); ++i)
+                    ptr[i] = v[i];
+                break;
+            }
+            case dt::f16: {
+                auto ptr = map_memory<float16_t>(mem);
+                for (size_t i = 0; i < v.size(); ++i)
+                    ptr[i] = v[i];
+                break;
+            }
+            default: {
+                auto ptr = map_memory<float>(mem);
+                for (size_t i = 0; i < v.size(); ++i)
+                    ptr[i] = v[i];
+            }
+        }
+    }
+
+protected:
+    void SetUp() override {
+        p = ::testing::TestWithParam<decltype(p)>::GetParam();
+
+        SKIP_IF(unsupported_data_type(p.src_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(p.diff_src_dt != dt::undef
+                        && unsupported_data_type(p.diff_src_dt),
+                "Engine does not support this data type.");
+        SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+                "Engine does not support this primitive.");
+
+        catch_expected_failures(
+                [&]() { Test(); }, p.expect_to_fail, p.expected_status);
+    }
+
+    void Test() {
+        using pd_t = softmax_cross_entropy::primitive_desc;
+        allows_attr_t allowed_attributes {false}; // doesn't support anything
+
+        auto eng = get_test_engine();
+        auto strm = make_stream(eng);
+
+        const bool with_diff_src = p.diff_src_dt != dt::undef;
+        auto src_md = memory::desc({p.n, p.c}, p.src_dt, tag::any);
+        auto labels_md = memory::desc({p.n}, dt::s32, tag::a);
+        auto dst_md = memory::desc({p.n}, dt::f32, tag::a);
+        auto diff_src_md = with_diff_src
+                ? memory::desc({p.n, p.c}, p.diff_src_dt, tag::any)
+                : memory::desc();
+
+        // default pd ctor
+        auto pd = pd_t();
+        // regular pd ctor
+        pd = pd_t(eng, src_md, labels_md, dst_md, diff_src_md,
+                p.label_smoothing);
+        // test all pd ctors
+        test_fwd_pd_constructors<pd_t>(pd, allowed_attributes, src_md,
+                labels_md, dst_md, diff_src_md, p.label_smoothing);
+
+        // The gradient is scaled through a runtime scale.
+        primitive_attr attr;
+        if (with_diff_src) attr.set_scales_mask(DNNL_ARG_DIFF_SRC, 0);
+        pd = pd_t(eng, src_md, labels_md, dst_md, diff_src_md,
+                p.label_smoothing, attr);
+
+        EXPECT_ANY_THROW(softmax_cross_entropy(pd, {}));
+        // default primitive ctor
+        auto prim = softmax_cross_entropy();
+        // regular primitive ctor
+        prim = softmax_cross_entropy(pd);
+
+        ASSERT_TRUE(pd.labels_desc() == labels_md);
+        ASSERT_TRUE(pd.dst_desc() == dst_md);
+        ASSERT_EQ(pd.diff_src_desc().is_zero(), !with_diff_src);
+        ASSERT_TRUE(pd.query_md(query::exec_arg_md, DNNL_ARG_SRC)
+                == pd.src_desc());
+
+        // Every other row is shifted by a large value to check that the
+        // result does not depend on the magnitude of the logits. Every fifth
+        // sample is ignored.
+        const size_t n = (size_t)p.n, c = (size_t)p.c;
+        std::vector<float> x(n * c), labels(n);
+        for (size_t i = 0; i < n; ++i) {
+            for (size_t j = 0; j < c; ++j) {
+                const float v = float((i * 5 + j * 13) % 17) / 4.f - 2.f
+                        + (i % 2 ? 60.f : 0.f);
+                x[i * c + j] = p.src_dt == dt::bf16
+                        ? float(bfloat16_t(v))
+                        : p.src_dt == dt::f16 ? float(float16_t(v)) : v;
+            }
+            labels[i] = i % 5 == 4 ? -1.f : float((i * 7919) % c);
+        }
+
+        auto src = test::make_memory(pd.src_desc(), eng);
+        auto lbl = test::make_memory(pd.labels_desc(), eng);
+        auto dst = test::make_memory(pd.dst_desc(), eng);
+        fill(src, x);
+        {
+            auto ptr = map_memory<int32_t>(lbl);
+            for (size_t i = 0; i < n; ++i)
+                ptr[i] = (int32_t)labels[i];
+        }
+
+        std::unordered_map<int, memory> args = {{DNNL_ARG_SRC, src},
+                {DNNL_ARG_LABELS, lbl}, {DNNL_ARG_DST, dst}};
+        memory diff_src;
+        const float scale = 1.f / p.n;
+        if (with_diff_src) {
+            diff_src = test::make_memory(pd.diff_src_desc(), eng);
+            auto scale_mem = test::make_memory(
+                    memory::desc({1}, dt::f32, tag::x), eng);
+            fill(scale_mem, {scale});
+            args.insert({DNNL_ARG_DIFF_SRC, diff_src});
+            args.insert({DNNL_ARG_ATTR_SCALES | DNNL_ARG_DIFF_SRC, scale_mem});
+        }
+
+        prim.execute(strm, args);
+        strm.wait();
+
+        const double eps_s = p.label_smoothing;
+        const float grad_eps = p.diff_src_dt == dt::f32 ? 1e-6f : 5e-3f;
+        for (size_t i = 0; i < n; ++i) {
+            const float *row = &x[i * c];
+            const int label = (int)labels[i];
+            if (label < 0) {
+                ASSERT_EQ(get_elem(dst, i), 0.f) << "loss at " << i;
+                for (size_t j = 0; with_diff_src && j < c; ++j)
+                    ASSERT_EQ(get_elem(diff_src, i * c + j), 0.f)
+                            << "diff_src at " << i << ", " << j;
+                continue;
+            }
+
+            double max = row[0];
+            for (size_t j = 1; j < c; ++j)
+                max = std::max(max, (double)row[j]);
+            double sum_exp = 0;
+            for (size_t j = 0; j < c; ++j)
+                sum_exp += std::exp(row[j] - max);
+            const double lse = max + std::log(sum_exp);
+
+            double loss = 0;
+            for (size_t j = 0; j < c; ++j) {
+                const double q = (j == (size_t)label ? 1 - eps_s : 0)
+                        + eps_s / c;
+                loss -= q * (row[j] - lse);
+            }
+            ASSERT_NEAR(get_elem(dst, i), loss, 1e-4 * (1 + std::fabs(loss)))
+                    << "loss at " << i;
+
+            for (size_t j = 0; with_diff_src && j < c; ++j) {
+                const double q = (j == (size_t)label ? 1 - eps_s : 0)
+                        + eps_s / c;
+                const double grad = scale * (std::exp(row[j] - lse) - q);
+                ASSERT_NEAR(get_elem(diff_src, i * c + j), grad,
+                        grad_eps * scale)
+                        << "diff_src at " << i << ", " << j;
+            }
+        }
+    }
+};
+
+TEST(softmax_cross_entropy_exec_test_t, TestsLabelOutOfRange) {
+    SKIP_IF(get_test_engine_kind() != engine::kind::cpu,
+            "Engine does not support this primitive.");
+    auto eng = get_test_engine();
+    auto strm = make_stream(eng);
+
+    auto src_md = memory::desc({2, 8}, dt::f32, tag::ab);
+    auto labels_md = memory::desc({2}, dt::s32, tag::a);
+    auto dst_md = memory::desc({2}, dt::f32, tag::a);
+    auto pd = softmax_cross_entropy::primitive_desc(
+            eng, src_md, labels_md, dst_md, src_md, 0.f);
+
+    auto src = test::make_memory(src_md, eng);
+    auto labels = test::make_memory(labels_md, eng);
+    auto dst = test::make_memory(dst_md, eng);
+    auto diff_src = test::make_memory(src_md, eng);
+    {
+        auto ptr = map_memory<int32_t>(labels);
+        ptr[0] = 1;
+        ptr[1] = 8;
+    }
+    EXPECT_ANY_THROW(softmax_cross_entropy(pd).execute(strm,
+            {{DNNL_ARG_SRC, src}, {DNNL_ARG_LABELS, labels},
+                    {DNNL_ARG_DST, dst}, {DNNL_ARG_DIFF_SRC, diff_src}}));
+}
+
+static auto expected_failures = []() {
+    return ::testing::Values(
+            // label smoothing out of range
+            softmax_cross_entropy_test_params_t {dt::f32, dt::f32, 4, 10, 1.f,
+                    true, dnnl_invalid_arguments},
+            softmax_cross_entropy_test_params_t {dt::f32, dt::f32, 4, 10,
+                    -0.1f, true, dnnl_invalid_arguments},
+            // integer logits
+            softmax_cross_entropy_test_params_t {dt::s8, dt::undef, 4, 10, 0.f,
+                    true, dnnl_unimplemented});
+};
+
+static auto f32_cases = []() {
+    return ::testing::Values(
+            softmax_cross_entropy_test_params_t {
+                    dt::f32, dt::f32, 10, 7, 0.f},
+            softmax_cross_entropy_test_params_t {
+                    dt::f32, dt::undef, 10, 7, 0.1f},
+            softmax_cross_entropy_test_params_t {
+                    dt::f32, dt::f32, 9, 1024, 0.1f},
+            softmax_cross_entropy_test_params_t {
+                    dt::f32, dt::f32, 6, 5000, 0.2f});
+};
+
+static auto mixed_cases = []() {
+    return ::testing::Values(
+            softmax_cross_entropy_test_params_t {
+                    dt::bf16, dt::bf16, 8, 3000, 0.1f},
+            softmax_cross_entropy_test_params_t {
+                    dt::bf16, dt::f32, 8, 100, 0.f},
+            softmax_cross_entropy_test_params_t {
+                    dt::f16, dt::f16, 5, 2049, 0.1f});
+};
+
+TEST_P(softmax_cross_entropy_test_t, TestsSoftmaxCrossEntropy) {}
+INSTANTIATE_TEST_SUITE_P(TestSoftmaxCrossEntropyEF,
+        softmax_cross_entropy_test_t, expected_failures());
+INSTANTIATE_TEST_SUITE_P(TestSoftmaxCrossEntropyF32,
+        softmax_cross_entropy_test_t, f32_cases());
+INSTANTIATE_TEST_SUITE_P(TestSoftmaxCrossEntropyMixed,
+        softmax_cross_entropy_test_t, mixed_cases());
+
+} // namespace dnnl